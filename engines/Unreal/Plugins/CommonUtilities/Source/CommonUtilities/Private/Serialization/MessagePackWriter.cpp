@@ -0,0 +1,206 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Serialization/MessagePackWriter.h"
+#include <bit>
+
+namespace
+{
+    namespace Code
+    {
+        constexpr uint8 Nil = 0xc0;
+        constexpr uint8 False = 0xc2;
+        constexpr uint8 True = 0xc3;
+        constexpr uint8 Bin8 = 0xc4;
+        constexpr uint8 Bin16 = 0xc5;
+        constexpr uint8 Bin32 = 0xc6;
+        constexpr uint8 Float32 = 0xca;
+        constexpr uint8 Float64 = 0xcb;
+        constexpr uint8 UInt8 = 0xcc;
+        constexpr uint8 UInt16 = 0xcd;
+        constexpr uint8 UInt32 = 0xce;
+        constexpr uint8 UInt64 = 0xcf;
+        constexpr uint8 Int8 = 0xd0;
+        constexpr uint8 Int16 = 0xd1;
+        constexpr uint8 Int32 = 0xd2;
+        constexpr uint8 Int64 = 0xd3;
+        constexpr uint8 Str8 = 0xd9;
+        constexpr uint8 Str16 = 0xda;
+        constexpr uint8 Str32 = 0xdb;
+        constexpr uint8 Array16 = 0xdc;
+        constexpr uint8 Array32 = 0xdd;
+        constexpr uint8 Map16 = 0xde;
+        constexpr uint8 Map32 = 0xdf;
+        constexpr uint8 FixMap = 0x80;
+        constexpr uint8 FixArray = 0x90;
+        constexpr uint8 FixStr = 0xa0;
+    } // namespace Code
+} // namespace
+
+void FMessagePackWriter::WriteNil()
+{
+    Buffer.Add(Code::Nil);
+}
+
+void FMessagePackWriter::WriteBool(const bool Value)
+{
+    Buffer.Add(Value ? Code::True : Code::False);
+}
+
+void FMessagePackWriter::WriteInt(const int64 Value)
+{
+    if (Value >= 0)
+    {
+        WriteUInt(static_cast<uint64>(Value));
+    }
+    else if (Value >= -32)
+    {
+        Buffer.Add(static_cast<uint8>(static_cast<int8>(Value)));
+    }
+    else if (Value >= MIN_int8)
+    {
+        WriteBigEndian(Code::Int8, static_cast<int8>(Value));
+    }
+    else if (Value >= MIN_int16)
+    {
+        WriteBigEndian(Code::Int16, static_cast<int16>(Value));
+    }
+    else if (Value >= MIN_int32)
+    {
+        WriteBigEndian(Code::Int32, static_cast<int32>(Value));
+    }
+    else
+    {
+        WriteBigEndian(Code::Int64, Value);
+    }
+}
+
+void FMessagePackWriter::WriteUInt(const uint64 Value)
+{
+    if (Value <= 0x7f)
+    {
+        Buffer.Add(static_cast<uint8>(Value));
+    }
+    else if (Value <= MAX_uint8)
+    {
+        WriteBigEndian(Code::UInt8, static_cast<uint8>(Value));
+    }
+    else if (Value <= MAX_uint16)
+    {
+        WriteBigEndian(Code::UInt16, static_cast<uint16>(Value));
+    }
+    else if (Value <= MAX_uint32)
+    {
+        WriteBigEndian(Code::UInt32, static_cast<uint32>(Value));
+    }
+    else
+    {
+        WriteBigEndian(Code::UInt64, Value);
+    }
+}
+
+void FMessagePackWriter::WriteFloat(const float Value)
+{
+    WriteBigEndian(Code::Float32, std::bit_cast<uint32>(Value));
+}
+
+void FMessagePackWriter::WriteDouble(const double Value)
+{
+    WriteBigEndian(Code::Float64, std::bit_cast<uint64>(Value));
+}
+
+void FMessagePackWriter::WriteString(const FStringView Value)
+{
+    const FTCHARToUTF8 Converted(Value.GetData(), Value.Len());
+    WriteString(FUtf8StringView(reinterpret_cast<const UTF8CHAR *>(Converted.Get()), Converted.Length()));
+}
+
+void FMessagePackWriter::WriteString(const FUtf8StringView Value)
+{
+    const auto Length = static_cast<uint32>(Value.Len());
+    if (Length <= 31)
+    {
+        Buffer.Add(static_cast<uint8>(Code::FixStr | Length));
+    }
+    else if (Length <= MAX_uint8)
+    {
+        WriteBigEndian(Code::Str8, static_cast<uint8>(Length));
+    }
+    else if (Length <= MAX_uint16)
+    {
+        WriteBigEndian(Code::Str16, static_cast<uint16>(Length));
+    }
+    else
+    {
+        WriteBigEndian(Code::Str32, Length);
+    }
+
+    Buffer.Append(reinterpret_cast<const uint8 *>(Value.GetData()), Value.Len());
+}
+
+void FMessagePackWriter::WriteBinary(const TConstArrayView<uint8> Value)
+{
+    const auto Length = static_cast<uint32>(Value.Num());
+    if (Length <= MAX_uint8)
+    {
+        WriteBigEndian(Code::Bin8, static_cast<uint8>(Length));
+    }
+    else if (Length <= MAX_uint16)
+    {
+        WriteBigEndian(Code::Bin16, static_cast<uint16>(Length));
+    }
+    else
+    {
+        WriteBigEndian(Code::Bin32, Length);
+    }
+
+    Buffer.Append(Value);
+}
+
+void FMessagePackWriter::WriteArrayHeader(const uint32 Count)
+{
+    if (Count <= 15)
+    {
+        Buffer.Add(static_cast<uint8>(Code::FixArray | Count));
+    }
+    else if (Count <= MAX_uint16)
+    {
+        WriteBigEndian(Code::Array16, static_cast<uint16>(Count));
+    }
+    else
+    {
+        WriteBigEndian(Code::Array32, Count);
+    }
+}
+
+void FMessagePackWriter::WriteMapHeader(const uint32 Count)
+{
+    if (Count <= 15)
+    {
+        Buffer.Add(static_cast<uint8>(Code::FixMap | Count));
+    }
+    else if (Count <= MAX_uint16)
+    {
+        WriteBigEndian(Code::Map16, static_cast<uint16>(Count));
+    }
+    else
+    {
+        WriteBigEndian(Code::Map32, Count);
+    }
+}
+
+template <typename T>
+void FMessagePackWriter::WriteBigEndian(const uint8 Marker, const T Value)
+{
+    static_assert(std::is_integral_v<T>, "Values are written as their raw bits");
+
+    const auto Offset = Buffer.AddUninitialized(1 + sizeof(T));
+    auto *Destination = Buffer.GetData() + Offset;
+    Destination[0] = Marker;
+
+    auto Bits = static_cast<std::make_unsigned_t<T>>(Value);
+    for (int32 i = sizeof(T); i > 0; i--)
+    {
+        Destination[i] = static_cast<uint8>(Bits & 0xff);
+        Bits >>= 8;
+    }
+}
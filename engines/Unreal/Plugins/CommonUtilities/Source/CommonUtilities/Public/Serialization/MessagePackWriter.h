@@ -0,0 +1,48 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Appends MessagePack-encoded values to a byte buffer. Every value uses its smallest encoding, the same way the
+ * managed MessagePack serializer writes them, so the output can be read with the managed serializer directly.
+ */
+class COMMONUTILITIES_API FMessagePackWriter
+{
+  public:
+    explicit FMessagePackWriter(TArray<uint8> &InBuffer) : Buffer(InBuffer)
+    {
+    }
+
+    void WriteNil();
+    void WriteBool(bool Value);
+    void WriteInt(int64 Value);
+    void WriteUInt(uint64 Value);
+    void WriteFloat(float Value);
+    void WriteDouble(double Value);
+
+    /**
+     * Writes a string, transcoding it to UTF-8.
+     */
+    void WriteString(FStringView Value);
+
+    void WriteString(FUtf8StringView Value);
+    void WriteBinary(TConstArrayView<uint8> Value);
+
+    /**
+     * Starts an array. The next Count values written make up its elements.
+     */
+    void WriteArrayHeader(uint32 Count);
+
+    /**
+     * Starts a map. The next Count pairs of values written make up its keys and values.
+     */
+    void WriteMapHeader(uint32 Count);
+
+  private:
+    template <typename T>
+    void WriteBigEndian(uint8 Marker, T Value);
+
+    TArray<uint8> &Buffer;
+};
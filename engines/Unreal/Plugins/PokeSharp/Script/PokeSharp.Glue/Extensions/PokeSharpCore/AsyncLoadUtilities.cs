@@ -104,6 +104,90 @@ internal partial class USaveGameToSlotAsync
     }
 }
 
+internal partial class UGetSaveSlotSummariesAsync
+{
+    public Task<IReadOnlyList<FPokeSharpSaveSlotSummary>> Task => _tcs.Task;
+    private TaskCompletionSource<IReadOnlyList<FPokeSharpSaveSlotSummary>> _tcs = new();
+    private readonly Action _action;
+
+    public UGetSaveSlotSummariesAsync()
+    {
+        _action = OnAsyncCompleted;
+    }
+
+    public static Task<IReadOnlyList<FPokeSharpSaveSlotSummary>> GetSlotSummariesAsync()
+    {
+        var reader = NewObject<UGetSaveSlotSummariesAsync>(AsyncLoadUtilities.WorldContextObject);
+
+        NativeAsyncUtilities.InitializeAsyncAction(reader, reader._action);
+        reader.GetSlotSummaries();
+        return reader.Task;
+    }
+
+    public override void Dispose()
+    {
+        base.Dispose();
+        AsyncLoadUtilities.DisposeAsyncLoadTask(ref _tcs);
+    }
+
+    private void OnAsyncCompleted()
+    {
+        // The native array is only valid while the action is alive, so copy it out before handing it over
+        _tcs.TrySetResult(Summaries.ToArray());
+    }
+}
+
+internal partial class UPokeSharpSaveSlotOps
+{
+    public Task<bool> Task => _tcs.Task;
+    private TaskCompletionSource<bool> _tcs = new();
+    private readonly Action _action;
+
+    public UPokeSharpSaveSlotOps()
+    {
+        _action = OnAsyncCompleted;
+    }
+
+    public static Task<bool> CopySlotAsync(string sourceSlotName, string destinationSlotName, int userIndex)
+    {
+        var ops = Create();
+        ops.CopySlot(sourceSlotName, destinationSlotName, userIndex);
+        return ops.Task;
+    }
+
+    public static Task<bool> RenameSlotAsync(string sourceSlotName, string destinationSlotName, int userIndex)
+    {
+        var ops = Create();
+        ops.RenameSlot(sourceSlotName, destinationSlotName, userIndex);
+        return ops.Task;
+    }
+
+    public static Task<bool> DeleteSlotAsync(string slotName, int userIndex)
+    {
+        var ops = Create();
+        ops.DeleteSlot(slotName, userIndex);
+        return ops.Task;
+    }
+
+    private static UPokeSharpSaveSlotOps Create()
+    {
+        var ops = NewObject<UPokeSharpSaveSlotOps>(AsyncLoadUtilities.WorldContextObject);
+        NativeAsyncUtilities.InitializeAsyncAction(ops, ops._action);
+        return ops;
+    }
+
+    public override void Dispose()
+    {
+        base.Dispose();
+        AsyncLoadUtilities.DisposeAsyncLoadTask(ref _tcs);
+    }
+
+    private void OnAsyncCompleted()
+    {
+        _tcs.TrySetResult(Succeeded);
+    }
+}
+
 public static class SaveGameExtensions
 {
     extension(UGameplayStatics)
@@ -117,5 +201,43 @@ public static class SaveGameExtensions
         {
             return USaveGameToSlotAsync.SaveGameToSlotAsync(saveGame, slotName, userIndex);
         }
+
+        public static bool CopySaveSlot(string sourceSlotName, string destinationSlotName, int userIndex)
+        {
+            return UPokeSharpSaveSlotOps.CopySlotBlocking(sourceSlotName, destinationSlotName, userIndex);
+        }
+
+        public static Task<bool> CopySaveSlotAsync(string sourceSlotName, string destinationSlotName, int userIndex)
+        {
+            return UPokeSharpSaveSlotOps.CopySlotAsync(sourceSlotName, destinationSlotName, userIndex);
+        }
+
+        public static bool RenameSaveSlot(string sourceSlotName, string destinationSlotName, int userIndex)
+        {
+            return UPokeSharpSaveSlotOps.RenameSlotBlocking(sourceSlotName, destinationSlotName, userIndex);
+        }
+
+        public static Task<bool> RenameSaveSlotAsync(string sourceSlotName, string destinationSlotName, int userIndex)
+        {
+            return UPokeSharpSaveSlotOps.RenameSlotAsync(sourceSlotName, destinationSlotName, userIndex);
+        }
+
+        public static bool DeleteSaveSlot(string slotName, int userIndex)
+        {
+            return UPokeSharpSaveSlotOps.DeleteSlotBlocking(slotName, userIndex);
+        }
+
+        public static Task<bool> DeleteSaveSlotAsync(string slotName, int userIndex)
+        {
+            return UPokeSharpSaveSlotOps.DeleteSlotAsync(slotName, userIndex);
+        }
+    }
+
+    extension(UPokeSharpSaveSlotIndex)
+    {
+        public static Task<IReadOnlyList<FPokeSharpSaveSlotSummary>> GetSlotSummariesAsync()
+        {
+            return UGetSaveSlotSummariesAsync.GetSlotSummariesAsync();
+        }
     }
 }
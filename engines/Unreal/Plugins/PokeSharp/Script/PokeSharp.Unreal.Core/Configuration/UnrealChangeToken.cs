@@ -1,6 +1,10 @@
-﻿using System.Runtime.InteropServices;
+﻿using System.Collections.Immutable;
+using System.Runtime.InteropServices;
 using Microsoft.Extensions.Primitives;
+using PokeSharp.Core.Strings;
 using PokeSharp.Unreal.Core.Interop;
+using PokeSharp.Unreal.Core.Strings;
+using UnrealSharp.Core;
 using UnrealSharp.CoreUObject;
 using UnrealSharp.DeveloperSettings;
 
@@ -11,6 +15,12 @@ public class UnrealChangeToken<TUnrealSettings> : IChangeToken
 {
     public bool HasChanged { get; private set; }
 
+    /// <summary>
+    /// The names of the properties that changed in the most recent batch of changes, so listeners can update only
+    /// what is affected.
+    /// </summary>
+    public ImmutableArray<Name> ChangedProperties { get; private set; } = [];
+
     public bool ActiveChangeCallbacks => true;
 
     public IDisposable RegisterChangeCallback(Action<object?> callback, object? state)
@@ -46,6 +56,15 @@ public class UnrealChangeToken<TUnrealSettings> : IChangeToken
 
         private void Invoke()
         {
+            SettingsChangeExporter.CallGetChangedProperties(out var properties, out var count);
+            var names = new ReadOnlySpan<FName>((void*)properties, count);
+            var builder = ImmutableArray.CreateBuilder<Name>(count);
+            foreach (var name in names)
+            {
+                builder.Add(name.ToPokeSharpName());
+            }
+
+            _owner.ChangedProperties = builder.MoveToImmutable();
             _callback(_state);
             _owner.HasChanged = true;
         }
@@ -17,4 +17,22 @@ public static class UnrealOptionsExtensions
         services.AddTransient<IOptionsFactory<TOptions>, UnrealOptionsFactory<TUnrealSettings, TOptions>>();
         return services;
     }
+
+    /// <summary>
+    /// Binds options to an Unreal settings object through a native snapshot of the whole object, which is decoded with
+    /// the MessagePack serializer instead of an <see cref="IUnrealOptionsMapper{TUnrealSettings,TOptions}"/>.
+    /// </summary>
+    public static IServiceCollection AddUnrealSnapshotOptions<TUnrealSettings, TOptions>(
+        this IServiceCollection services
+    )
+        where TUnrealSettings : UDeveloperSettings
+        where TOptions : class
+    {
+        services.AddSingleton<
+            IOptionsChangeTokenSource<TOptions>,
+            UnrealOptionsChangeTokenSource<TUnrealSettings, TOptions>
+        >();
+        services.AddSingleton<IOptionsFactory<TOptions>, UnrealSnapshotOptionsFactory<TUnrealSettings, TOptions>>();
+        return services;
+    }
 }
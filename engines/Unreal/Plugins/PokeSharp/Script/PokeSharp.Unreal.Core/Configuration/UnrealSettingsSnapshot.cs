@@ -0,0 +1,100 @@
+﻿using System.Buffers;
+using MessagePack;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
+using UnrealSharp.DeveloperSettings;
+
+namespace PokeSharp.Unreal.Core.Configuration;
+
+/// <summary>
+/// A MessagePack snapshot of every config property of an Unreal settings object, written by native code in a single
+/// call. The buffer stays valid until this object is disposed.
+/// </summary>
+public sealed unsafe class UnrealSettingsSnapshot : MemoryManager<byte>
+{
+    private UnmanagedArray _buffer;
+
+    private UnrealSettingsSnapshot(UnmanagedArray buffer)
+    {
+        _buffer = buffer;
+    }
+
+    ~UnrealSettingsSnapshot()
+    {
+        Dispose(false);
+    }
+
+    /// <summary>
+    /// The hash of the names and types of the properties in the snapshot, which changes whenever its layout does.
+    /// </summary>
+    public uint SchemaHash { get; private set; }
+
+    /// <summary>
+    /// The settings themselves, encoded as a map from property name to value.
+    /// </summary>
+    public ReadOnlyMemory<byte> Settings { get; private set; }
+
+    /// <summary>
+    /// Takes a snapshot of the given settings object.
+    /// </summary>
+    /// <param name="settings">The settings to snapshot.</param>
+    /// <returns>The snapshot, which must be disposed once it has been read.</returns>
+    public static UnrealSettingsSnapshot Take(UDeveloperSettings settings)
+    {
+        var buffer = new UnmanagedArray();
+        SettingsSnapshotExporter.CallTakeSnapshot(settings.NativeObject, ref buffer);
+
+        var snapshot = new UnrealSettingsSnapshot(buffer);
+        try
+        {
+            snapshot.ReadHeader();
+            return snapshot;
+        }
+        catch
+        {
+            snapshot.Dispose();
+            throw;
+        }
+    }
+
+    public override Span<byte> GetSpan()
+    {
+        ObjectDisposedException.ThrowIf(_buffer.Data == IntPtr.Zero, this);
+        return new Span<byte>((byte*)_buffer.Data, _buffer.ArrayNum);
+    }
+
+    public override MemoryHandle Pin(int elementIndex = 0)
+    {
+        ObjectDisposedException.ThrowIf(_buffer.Data == IntPtr.Zero, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(elementIndex);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(elementIndex, _buffer.ArrayNum);
+
+        // The buffer lives in native memory and never moves
+        return new MemoryHandle((byte*)_buffer.Data + elementIndex);
+    }
+
+    public override void Unpin()
+    {
+        // Nothing to unpin
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        if (_buffer.Data == IntPtr.Zero)
+            return;
+
+        SettingsSnapshotExporter.CallReleaseSnapshot(ref _buffer);
+        _buffer = default;
+        Settings = default;
+    }
+
+    private void ReadHeader()
+    {
+        var reader = new MessagePackReader(Memory);
+        if (reader.ReadArrayHeader() != 2)
+            throw new InvalidDataException("Settings snapshot does not start with a schema hash");
+
+        SchemaHash = reader.ReadUInt32();
+        Settings = Memory[(int)reader.Consumed..];
+    }
+}
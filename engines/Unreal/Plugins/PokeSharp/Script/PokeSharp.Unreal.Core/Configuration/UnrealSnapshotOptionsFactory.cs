@@ -0,0 +1,40 @@
+﻿using MessagePack;
+using Microsoft.Extensions.Options;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.DeveloperSettings;
+
+namespace PokeSharp.Unreal.Core.Configuration;
+
+/// <summary>
+/// Creates options by decoding a native snapshot of an Unreal settings object, instead of reading its properties
+/// through the reflected glue one at a time. The options type has to be readable by the MessagePack serializer with
+/// string keys matching the names of the Unreal properties.
+/// </summary>
+public class UnrealSnapshotOptionsFactory<TUnrealSettings, TOptions>(MessagePackSerializerOptions serializerOptions)
+    : IOptionsFactory<TOptions>
+    where TUnrealSettings : UDeveloperSettings
+    where TOptions : class
+{
+    private readonly Lock _lock = new();
+    private uint _schemaHash;
+    private byte[]? _settings;
+    private TOptions? _options;
+
+    public TOptions Create(string name)
+    {
+        using var snapshot = UnrealSettingsSnapshot.Take(UObject.GetDefault<TUnrealSettings>());
+        var settings = snapshot.Settings.Span;
+
+        lock (_lock)
+        {
+            // Change notifications also fire for edits that end up not changing any config value
+            if (_options is not null && snapshot.SchemaHash == _schemaHash && settings.SequenceEqual(_settings))
+                return _options;
+
+            _options = MessagePackSerializer.Deserialize<TOptions>(snapshot.Settings, serializerOptions);
+            _schemaHash = snapshot.SchemaHash;
+            _settings = settings.ToArray();
+            return _options;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+﻿using PokeSharp.Unreal.Core.FileSystem;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Diagnostics;
+
+/// <summary>
+/// Reads the I/O counters the engine keeps for the file handle, archive and save game interop surfaces. The same data
+/// is also available through the <c>stat PokeSharpIO</c> stat group and the <c>PokeSharpIO</c> Insights trace channel.
+/// </summary>
+public static class UnrealIOStats
+{
+    /// <summary>
+    /// Gets the aggregate counters for every operation that went through the given interop surface.
+    /// </summary>
+    /// <param name="source">The interop surface to get the counters for.</param>
+    /// <returns>The current counters.</returns>
+    public static IOStatsSnapshot GetSnapshot(IOSource source)
+    {
+        PokeSharpIOStatsExporter.CallGetSnapshot(source, out var snapshot);
+        return snapshot;
+    }
+
+    /// <summary>
+    /// Gets the counters for a single open file. These are only collected while the
+    /// <c>PokeSharp.IO.TrackHandles</c> console variable is enabled.
+    /// </summary>
+    /// <param name="stream">The file to get the counters for.</param>
+    /// <param name="snapshot">The current counters for the file.</param>
+    /// <returns>Whether any counters were recorded for the file.</returns>
+    public static bool TryGetSnapshot(UnrealFileSystemStream stream, out IOStatsSnapshot snapshot)
+    {
+        return PokeSharpIOStatsExporter.CallGetHandleSnapshot(stream.FileHandle, out snapshot).ToManagedBool();
+    }
+
+    /// <summary>
+    /// Resets all aggregate counters and drops all per-file counters.
+    /// </summary>
+    public static void Reset()
+    {
+        PokeSharpIOStatsExporter.CallReset();
+    }
+}
@@ -0,0 +1,8 @@
+﻿namespace PokeSharp.Unreal.Core.FileSystem;
+
+/// <summary>
+/// A range of bytes within a file.
+/// </summary>
+/// <param name="Offset">The offset of the first byte of the range.</param>
+/// <param name="Length">The number of bytes in the range.</param>
+public readonly record struct FileRange(long Offset, int Length);
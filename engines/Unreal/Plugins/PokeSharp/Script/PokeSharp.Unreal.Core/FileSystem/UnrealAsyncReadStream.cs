@@ -0,0 +1,218 @@
+﻿using System.Buffers;
+using System.Runtime.InteropServices;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.FileSystem;
+
+/// <summary>
+/// A read-only stream backed by an Unreal <c>IAsyncReadFileHandle</c>. Asynchronous reads are issued as ranged requests
+/// that complete on the I/O thread, so awaiting them never blocks the game thread.
+/// </summary>
+public sealed class UnrealAsyncReadStream : Stream
+{
+    private IntPtr _fileHandle;
+    private long _length = -1;
+    private long _position;
+    private bool _disposed;
+
+    public UnrealAsyncReadStream(ReadOnlySpan<char> path)
+    {
+        unsafe
+        {
+            fixed (char* pathPtr = path)
+            {
+                _fileHandle = AsyncFileExporter.CallOpenRead((IntPtr)pathPtr);
+            }
+        }
+
+        if (_fileHandle == IntPtr.Zero)
+            throw new FileNotFoundException("Failed to open file");
+    }
+
+    ~UnrealAsyncReadStream()
+    {
+        Dispose(false);
+    }
+
+    public override bool CanRead => true;
+    public override bool CanSeek => true;
+    public override bool CanWrite => false;
+
+    public override long Length
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+            return _length >= 0 ? _length : GetLengthAsync().AsTask().GetAwaiter().GetResult();
+        }
+    }
+
+    public override long Position
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+            return _position;
+        }
+        set
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+            ArgumentOutOfRangeException.ThrowIfNegative(value);
+            _position = value;
+        }
+    }
+
+    /// <summary>
+    /// Asynchronously retrieves the size of the file, caching it for subsequent calls.
+    /// </summary>
+    /// <param name="cancellationToken">A token to cancel the size request.</param>
+    /// <returns>The size of the file in bytes.</returns>
+    public async ValueTask<long> GetLengthAsync(CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (_length >= 0)
+            return _length;
+
+        _length = await AwaitRequestAsync(
+                callback => AsyncFileExporter.CallRequestSize(_fileHandle, callback),
+                cancellationToken
+            )
+            .ConfigureAwait(false);
+        return _length;
+    }
+
+    /// <summary>
+    /// Hints to the platform that the given range will be read soon, allowing it to be pulled into the cache while
+    /// other work is happening.
+    /// </summary>
+    /// <param name="offset">The offset of the range to precache.</param>
+    /// <param name="count">The number of bytes to precache.</param>
+    /// <param name="cancellationToken">A token to cancel the precache request.</param>
+    public async ValueTask PrecacheAsync(long offset, long count, CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        count = Math.Min(count, await GetLengthAsync(cancellationToken).ConfigureAwait(false) - offset);
+        if (count <= 0)
+            return;
+
+        await AwaitRequestAsync(
+                callback =>
+                    AsyncFileExporter.CallRequestRead(
+                        _fileHandle,
+                        offset,
+                        count,
+                        IntPtr.Zero,
+                        NativeBool.True,
+                        callback
+                    ),
+                cancellationToken
+            )
+            .ConfigureAwait(false);
+    }
+
+    public override void Flush()
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        // Read-only, so there is nothing to flush
+    }
+
+    public override int Read(byte[] buffer, int offset, int count)
+    {
+        return ReadAsync(buffer.AsMemory(offset, count)).AsTask().GetAwaiter().GetResult();
+    }
+
+    public override Task<int> ReadAsync(byte[] buffer, int offset, int count, CancellationToken cancellationToken)
+    {
+        return ReadAsync(buffer.AsMemory(offset, count), cancellationToken).AsTask();
+    }
+
+    public override async ValueTask<int> ReadAsync(Memory<byte> buffer, CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        var toRead = Math.Min(buffer.Length, await GetLengthAsync(cancellationToken).ConfigureAwait(false) - _position);
+        if (toRead <= 0)
+            return 0;
+
+        using var pinnedBuffer = buffer.Pin();
+        var bufferPtr = GetPointer(pinnedBuffer);
+        var readPosition = _position;
+        var read = await AwaitRequestAsync(
+                callback =>
+                    AsyncFileExporter.CallRequestRead(
+                        _fileHandle,
+                        readPosition,
+                        toRead,
+                        bufferPtr,
+                        NativeBool.False,
+                        callback
+                    ),
+                cancellationToken
+            )
+            .ConfigureAwait(false);
+
+        _position += read;
+        return (int)read;
+    }
+
+    public override long Seek(long offset, SeekOrigin origin)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        Position = origin switch
+        {
+            SeekOrigin.Begin => offset,
+            SeekOrigin.Current => _position + offset,
+            SeekOrigin.End => Length + offset,
+            _ => throw new ArgumentOutOfRangeException(nameof(origin), origin, null),
+        };
+
+        return _position;
+    }
+
+    public override void SetLength(long value)
+    {
+        throw new NotSupportedException("Cannot set length of a read-only stream");
+    }
+
+    public override void Write(byte[] buffer, int offset, int count)
+    {
+        throw new NotSupportedException("Cannot write to a read-only stream");
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        if (_disposed)
+            return;
+
+        AsyncFileExporter.CallClose(_fileHandle);
+        _fileHandle = IntPtr.Zero;
+        _disposed = true;
+    }
+
+    private static unsafe IntPtr GetPointer(MemoryHandle handle) => (IntPtr)handle.Pointer;
+
+    private static async ValueTask<long> AwaitRequestAsync(
+        Func<IntPtr, IntPtr> issueRequest,
+        CancellationToken cancellationToken
+    )
+    {
+        cancellationToken.ThrowIfCancellationRequested();
+
+        // Completion is signalled from the I/O thread, so continuations must not run inline on it
+        var completion = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+        var callbackHandle = GCHandle.Alloc((Action)(() => completion.TrySetResult()));
+
+        // Ownership of the GC handle passes to the native request, which frees it once finished
+        var request = issueRequest(GCHandle.ToIntPtr(callbackHandle));
+        await using (cancellationToken.Register(() => AsyncFileExporter.CallCancel(request)))
+        {
+            await completion.Task.ConfigureAwait(false);
+        }
+
+        if (AsyncFileExporter.CallFinish(request, out var result).ToManagedBool())
+            return result;
+
+        cancellationToken.ThrowIfCancellationRequested();
+        throw new IOException("Asynchronous file request failed");
+    }
+}
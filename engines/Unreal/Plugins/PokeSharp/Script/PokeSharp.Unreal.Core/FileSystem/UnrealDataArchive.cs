@@ -0,0 +1,89 @@
+﻿using PokeSharp.Unreal.Core.Interop;
+using PokeSharp.Unreal.Core.Utils;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.FileSystem;
+
+/// <summary>
+/// A packed data archive opened by the engine. All entries are served through the single file handle held by the
+/// native archive.
+/// </summary>
+public sealed unsafe class UnrealDataArchive : IDisposable
+{
+    private SharedPtr _archive;
+
+    private UnrealDataArchive(SharedPtr archive)
+    {
+        _archive = archive;
+    }
+
+    ~UnrealDataArchive()
+    {
+        Dispose(false);
+    }
+
+    /// <summary>
+    /// Attempts to open the data archive at the given engine path.
+    /// </summary>
+    /// <param name="path">The engine path of the archive.</param>
+    /// <returns>The opened archive, or <see langword="null"/> if there is no valid archive at that path.</returns>
+    public static UnrealDataArchive? TryOpen(ReadOnlySpan<char> path)
+    {
+        var archive = new SharedPtr();
+        fixed (char* pathPtr = path)
+        {
+            if (!DataArchiveExporter.CallOpen((IntPtr)pathPtr, ref archive).ToManagedBool())
+            {
+                return null;
+            }
+        }
+
+        return new UnrealDataArchive(archive);
+    }
+
+    /// <summary>
+    /// Checks if the archive has an entry with the given name.
+    /// </summary>
+    /// <param name="name">The name of the entry.</param>
+    /// <returns>Whether the entry exists.</returns>
+    public bool Contains(ReadOnlySpan<char> name)
+    {
+        ObjectDisposedException.ThrowIf(_archive.Pointer == IntPtr.Zero, this);
+        fixed (char* namePtr = name)
+        {
+            return DataArchiveExporter.CallContains(_archive.Pointer, (IntPtr)namePtr, name.Length).ToManagedBool();
+        }
+    }
+
+    /// <summary>
+    /// Opens a read-only stream over the entry with the given name.
+    /// </summary>
+    /// <param name="name">The name of the entry.</param>
+    /// <returns>The stream, or <see langword="null"/> if the entry does not exist.</returns>
+    public Stream? OpenEntry(ReadOnlySpan<char> name)
+    {
+        ObjectDisposedException.ThrowIf(_archive.Pointer == IntPtr.Zero, this);
+        IntPtr handle;
+        fixed (char* namePtr = name)
+        {
+            handle = DataArchiveExporter.CallOpenEntry(_archive.Pointer, (IntPtr)namePtr, name.Length);
+        }
+
+        return handle != IntPtr.Zero ? new UnrealFileSystemStream(handle, FileAccess.Read) : null;
+    }
+
+    public void Dispose()
+    {
+        Dispose(true);
+        GC.SuppressFinalize(this);
+    }
+
+    private void Dispose(bool disposing)
+    {
+        if (_archive.Pointer == IntPtr.Zero)
+            return;
+
+        DataArchiveExporter.CallRelease(ref _archive);
+        _archive = default;
+    }
+}
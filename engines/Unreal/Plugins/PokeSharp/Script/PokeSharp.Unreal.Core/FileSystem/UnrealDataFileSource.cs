@@ -1,19 +1,86 @@
-﻿using PokeSharp.Core.Data;
+﻿using System.Buffers;
+using System.Collections.Concurrent;
+using PokeSharp.Core.Data;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
 using UnrealSharp.UnrealSharpCore;
 
 namespace PokeSharp.Unreal.Core.FileSystem;
 
 [RegisterSingleton]
-public class UnrealDataFileSource : IDataFileSource
+public class UnrealDataFileSource : IMappedDataFileSource
 {
+    private readonly ConcurrentDictionary<string, Lazy<UnrealDataArchive?>> _archives = new();
+
     public Stream OpenRead(string path)
     {
-        return new UnrealFileSystemStream(CreatePath(path), FileMode.Open);
+        var archive = GetArchive(path);
+        var entry = archive?.OpenEntry(Path.GetFileName(path));
+        if (entry is not null)
+        {
+            return entry;
+        }
+
+        // Block-compressed files are decompressed by the native file handle, which the async path doesn't go through
+        var enginePath = CreatePath(path);
+        return IsBlockCompressed(enginePath)
+            ? new UnrealFileSystemStream(enginePath, FileMode.Open, FileAccess.Read)
+            : new UnrealAsyncReadStream(enginePath);
+    }
+
+    public IMemoryOwner<byte>? OpenMapped(string path)
+    {
+        // The archive wins over loose files, just like in OpenRead. Packed entries share the archive's handle, so they
+        // are always read through OpenRead instead, and a stale loose copy that was preloaded is no longer needed.
+        var enginePath = CreatePath(path);
+        var archive = GetArchive(path);
+        if (archive is not null && archive.Contains(Path.GetFileName(path)))
+        {
+            UnrealPreloadedFile.Discard(enginePath);
+            return null;
+        }
+
+        var preloaded = UnrealPreloadedFile.TryClaim(enginePath);
+        if (preloaded is not null)
+        {
+            return preloaded;
+        }
+
+        return UnrealMappedFile.TryOpen(enginePath);
     }
 
     public Stream OpenWrite(string path)
     {
-        return new FileStream(CreatePath(path), FileMode.Create);
+        // Writing into a directory invalidates its archive, and the archive file itself can't be replaced while open
+        if (_archives.TryRemove(Path.GetDirectoryName(path) ?? string.Empty, out var archive) && archive.IsValueCreated)
+        {
+            archive.Value?.Dispose();
+        }
+
+        var enginePath = CreatePath(path);
+        UnrealPreloadedFile.Discard(enginePath);
+        return new FileStream(enginePath, FileMode.Create);
+    }
+
+    private UnrealDataArchive? GetArchive(string path)
+    {
+        var directory = Path.GetDirectoryName(path) ?? string.Empty;
+        return _archives
+            .GetOrAdd(
+                directory,
+                d => new Lazy<UnrealDataArchive?>(() =>
+                    UnrealDataArchive.TryOpen(CreatePath(Path.Join(d, DataArchive.FileName)))
+                )
+            )
+            .Value;
+    }
+
+    private static unsafe bool IsBlockCompressed(string path)
+    {
+        fixed (char* pathPtr = path)
+        {
+            return PlatformFileExporter.CallIsBlockCompressed((IntPtr)pathPtr).ToManagedBool();
+        }
     }
 
     private static string CreatePath(string path)
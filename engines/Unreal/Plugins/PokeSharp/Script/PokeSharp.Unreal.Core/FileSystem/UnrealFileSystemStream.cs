@@ -1,4 +1,5 @@
-﻿using PokeSharp.Unreal.Core.Interop;
+﻿using System.Buffers;
+using PokeSharp.Unreal.Core.Interop;
 using UnrealSharp.Core;
 
 namespace PokeSharp.Unreal.Core.FileSystem;
@@ -9,11 +10,22 @@ public sealed class UnrealFileSystemStream : Stream
     private bool _disposed;
     private readonly FileAccess _access;
 
+    /// <summary>
+    /// The default size of the native read-ahead/write-behind buffer placed in front of the file handle.
+    /// </summary>
+    public const int DefaultBufferSize = 64 * 1024;
+
     public UnrealFileSystemStream(ReadOnlySpan<char> path, FileMode mode)
         : this(path, mode, mode == FileMode.Append ? FileAccess.Write : FileAccess.ReadWrite) { }
 
-    public UnrealFileSystemStream(ReadOnlySpan<char> path, FileMode fileMode, FileAccess access)
+    public UnrealFileSystemStream(
+        ReadOnlySpan<char> path,
+        FileMode fileMode,
+        FileAccess access,
+        int bufferSize = DefaultBufferSize
+    )
     {
+        ArgumentOutOfRangeException.ThrowIfNegative(bufferSize);
         unsafe
         {
             fixed (char* filenamePtr = path)
@@ -24,35 +36,41 @@ public sealed class UnrealFileSystemStream : Stream
                         (IntPtr)filenamePtr,
                         NativeBool.False,
                         access.HasFlag(FileAccess.Read).ToNativeBool(),
-                        NativeBool.False
+                        NativeBool.False,
+                        bufferSize
                     ),
                     FileMode.Create => PlatformFileExporter.CallOpenWrite(
                         (IntPtr)filenamePtr,
                         NativeBool.False,
                         access.HasFlag(FileAccess.Read).ToNativeBool(),
-                        NativeBool.False
+                        NativeBool.False,
+                        bufferSize
                     ),
                     FileMode.Open => PlatformFileExporter.CallOpenRead(
                         (IntPtr)filenamePtr,
-                        access.HasFlag(FileAccess.Write).ToNativeBool()
+                        access.HasFlag(FileAccess.Write).ToNativeBool(),
+                        bufferSize
                     ),
                     FileMode.OpenOrCreate => PlatformFileExporter.CallOpenWrite(
                         (IntPtr)filenamePtr,
                         NativeBool.False,
                         access.HasFlag(FileAccess.Read).ToNativeBool(),
-                        NativeBool.False
+                        NativeBool.False,
+                        bufferSize
                     ),
                     FileMode.Truncate => PlatformFileExporter.CallOpenWrite(
                         (IntPtr)filenamePtr,
                         NativeBool.False,
                         access.HasFlag(FileAccess.Read).ToNativeBool(),
-                        NativeBool.False
+                        NativeBool.False,
+                        bufferSize
                     ),
                     FileMode.Append => PlatformFileExporter.CallOpenWrite(
                         (IntPtr)filenamePtr,
                         NativeBool.False,
                         access.HasFlag(FileAccess.Read).ToNativeBool(),
-                        NativeBool.True
+                        NativeBool.True,
+                        bufferSize
                     ),
                     _ => throw new ArgumentOutOfRangeException(nameof(fileMode), fileMode, null),
                 };
@@ -64,6 +82,27 @@ public sealed class UnrealFileSystemStream : Stream
         _access = access;
     }
 
+    /// <summary>
+    /// Wraps a native file handle that has already been opened. The stream takes ownership of the handle.
+    /// </summary>
+    internal UnrealFileSystemStream(IntPtr fileHandle, FileAccess access)
+    {
+        _fileHandle = fileHandle;
+        _access = access;
+    }
+
+    /// <summary>
+    /// The native file handle backing this stream.
+    /// </summary>
+    internal IntPtr FileHandle
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(_disposed, this);
+            return _fileHandle;
+        }
+    }
+
     public override bool CanRead => _access.HasFlag(FileAccess.Read);
     public override bool CanSeek => true;
     public override bool CanWrite => _access.HasFlag(FileAccess.Write);
@@ -151,6 +190,107 @@ public sealed class UnrealFileSystemStream : Stream
         }
     }
 
+    /// <summary>
+    /// Reads several ranges of the file in a single native call. Ranges that are adjacent in the file are coalesced
+    /// natively. The stream's position is not affected.
+    /// </summary>
+    /// <param name="ranges">The ranges to read.</param>
+    /// <param name="destination">
+    /// The buffer to read into. Each range is written directly after the previous one, so this must be at least as
+    /// long as the combined length of all the ranges.
+    /// </param>
+    /// <exception cref="IOException">Thrown if any of the ranges could not be read in full.</exception>
+    public void ReadRanges(ReadOnlySpan<FileRange> ranges, Span<byte> destination)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (!_access.HasFlag(FileAccess.Read))
+            throw new UnauthorizedAccessException("File is not readable");
+
+        unsafe
+        {
+            fixed (byte* destinationPtr = destination)
+            {
+                if (!TransferRanges(ranges, destinationPtr, destination.Length, false))
+                {
+                    throw new IOException("Failed to read all requested ranges");
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Writes several ranges of the file in a single native call. Ranges that are adjacent in the file are coalesced
+    /// natively. The stream's position is not affected.
+    /// </summary>
+    /// <param name="ranges">The ranges to write.</param>
+    /// <param name="source">
+    /// The data to write. Each range takes its bytes directly after the previous one, so this must be at least as long
+    /// as the combined length of all the ranges.
+    /// </param>
+    /// <exception cref="IOException">Thrown if any of the ranges could not be written.</exception>
+    public void WriteRanges(ReadOnlySpan<FileRange> ranges, ReadOnlySpan<byte> source)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (!_access.HasFlag(FileAccess.Write))
+            throw new UnauthorizedAccessException("File is not writable");
+
+        unsafe
+        {
+            fixed (byte* sourcePtr = source)
+            {
+                if (!TransferRanges(ranges, sourcePtr, source.Length, true))
+                {
+                    throw new IOException("Failed to write all requested ranges");
+                }
+            }
+        }
+    }
+
+    private unsafe bool TransferRanges(ReadOnlySpan<FileRange> ranges, byte* buffer, int bufferLength, bool write)
+    {
+        const int maxStackVectors = 32;
+        FileIOVector[]? rented = null;
+        Span<FileIOVector> vectors =
+            ranges.Length <= maxStackVectors
+                ? stackalloc FileIOVector[maxStackVectors]
+                : rented = ArrayPool<FileIOVector>.Shared.Rent(ranges.Length);
+
+        try
+        {
+            var bufferOffset = 0L;
+            for (var i = 0; i < ranges.Length; i++)
+            {
+                var range = ranges[i];
+                ArgumentOutOfRangeException.ThrowIfNegative(range.Length);
+                if (bufferOffset + range.Length > bufferLength)
+                    throw new ArgumentException("Buffer is too small for the requested ranges");
+
+                vectors[i] = new FileIOVector
+                {
+                    Offset = range.Offset,
+                    Buffer = (IntPtr)(buffer + bufferOffset),
+                    Length = range.Length,
+                };
+                bufferOffset += range.Length;
+            }
+
+            fixed (FileIOVector* vectorsPtr = vectors)
+            {
+                var result = write
+                    ? FileHandleExporter.CallWriteVector(_fileHandle, vectorsPtr, ranges.Length)
+                    : FileHandleExporter.CallReadVector(_fileHandle, vectorsPtr, ranges.Length);
+                return result.ToManagedBool();
+            }
+        }
+        finally
+        {
+            if (rented is not null)
+            {
+                ArrayPool<FileIOVector>.Shared.Return(rented);
+            }
+        }
+    }
+
     protected override void Dispose(bool disposing)
     {
         if (_disposed)
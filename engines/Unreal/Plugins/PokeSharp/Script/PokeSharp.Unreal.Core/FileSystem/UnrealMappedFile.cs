@@ -0,0 +1,81 @@
+﻿using System.Buffers;
+using PokeSharp.Unreal.Core.Interop;
+
+namespace PokeSharp.Unreal.Core.FileSystem;
+
+/// <summary>
+/// Exposes the contents of a memory-mapped Unreal file as <see cref="Memory{T}"/> without copying it into the managed
+/// heap. The mapping stays valid until this object is disposed.
+/// </summary>
+public sealed unsafe class UnrealMappedFile : MemoryManager<byte>
+{
+    private IntPtr _mappedFile;
+    private readonly byte* _data;
+    private readonly int _length;
+
+    private UnrealMappedFile(IntPtr mappedFile, IntPtr data, long length)
+    {
+        if (length > int.MaxValue)
+        {
+            MappedFileExporter.CallClose(mappedFile);
+            throw new IOException("Mapped file is too large to expose as a single memory block");
+        }
+
+        _mappedFile = mappedFile;
+        _data = (byte*)data;
+        _length = (int)length;
+    }
+
+    ~UnrealMappedFile()
+    {
+        Dispose(false);
+    }
+
+    /// <summary>
+    /// Attempts to map the file at the given engine path into memory.
+    /// </summary>
+    /// <param name="path">The engine path of the file to map.</param>
+    /// <returns>The mapped file, or <see langword="null"/> if the platform could not map it.</returns>
+    public static UnrealMappedFile? TryOpen(ReadOnlySpan<char> path)
+    {
+        IntPtr mappedFile;
+        IntPtr data;
+        long length;
+        fixed (char* pathPtr = path)
+        {
+            mappedFile = MappedFileExporter.CallOpen((IntPtr)pathPtr, out data, out length);
+        }
+
+        return mappedFile != IntPtr.Zero ? new UnrealMappedFile(mappedFile, data, length) : null;
+    }
+
+    public override Span<byte> GetSpan()
+    {
+        ObjectDisposedException.ThrowIf(_mappedFile == IntPtr.Zero, this);
+        return new Span<byte>(_data, _length);
+    }
+
+    public override MemoryHandle Pin(int elementIndex = 0)
+    {
+        ObjectDisposedException.ThrowIf(_mappedFile == IntPtr.Zero, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(elementIndex);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(elementIndex, _length);
+
+        // The mapped pages never move, so there is nothing to actually pin
+        return new MemoryHandle(_data + elementIndex);
+    }
+
+    public override void Unpin()
+    {
+        // Nothing to unpin
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        if (_mappedFile == IntPtr.Zero)
+            return;
+
+        MappedFileExporter.CallClose(_mappedFile);
+        _mappedFile = IntPtr.Zero;
+    }
+}
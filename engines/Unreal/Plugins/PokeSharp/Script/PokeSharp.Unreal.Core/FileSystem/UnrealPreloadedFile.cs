@@ -0,0 +1,94 @@
+﻿using System.Buffers;
+using PokeSharp.Unreal.Core.Interop;
+
+namespace PokeSharp.Unreal.Core.FileSystem;
+
+/// <summary>
+/// Exposes a data file that the engine read into native memory during startup. The buffer stays valid until this
+/// object is disposed.
+/// </summary>
+public sealed unsafe class UnrealPreloadedFile : MemoryManager<byte>
+{
+    private IntPtr _buffer;
+    private readonly byte* _data;
+    private readonly int _length;
+
+    private UnrealPreloadedFile(IntPtr buffer, IntPtr data, long length)
+    {
+        if (length > int.MaxValue)
+        {
+            DataPreloaderExporter.CallRelease(buffer);
+            throw new IOException("Preloaded file is too large to expose as a single memory block");
+        }
+
+        _buffer = buffer;
+        _data = (byte*)data;
+        _length = (int)length;
+    }
+
+    ~UnrealPreloadedFile()
+    {
+        Dispose(false);
+    }
+
+    /// <summary>
+    /// Attempts to claim the preloaded contents of a data file, waiting for the read to finish if it is still running.
+    /// Each file can only be claimed once.
+    /// </summary>
+    /// <param name="contentPath">The content path of the file, such as <c>/Game/Data/Species.pkdata</c>.</param>
+    /// <returns>The preloaded file, or <see langword="null"/> if it was not preloaded.</returns>
+    public static UnrealPreloadedFile? TryClaim(ReadOnlySpan<char> contentPath)
+    {
+        IntPtr buffer;
+        IntPtr data;
+        long length;
+        fixed (char* contentPathPtr = contentPath)
+        {
+            buffer = DataPreloaderExporter.CallClaim((IntPtr)contentPathPtr, contentPath.Length, out data, out length);
+        }
+
+        return buffer != IntPtr.Zero ? new UnrealPreloadedFile(buffer, data, length) : null;
+    }
+
+    /// <summary>
+    /// Drops the preloaded contents of a data file without claiming them.
+    /// </summary>
+    /// <param name="contentPath">The content path of the file, such as <c>/Game/Data/Species.pkdata</c>.</param>
+    public static void Discard(ReadOnlySpan<char> contentPath)
+    {
+        fixed (char* contentPathPtr = contentPath)
+        {
+            DataPreloaderExporter.CallDiscard((IntPtr)contentPathPtr, contentPath.Length);
+        }
+    }
+
+    public override Span<byte> GetSpan()
+    {
+        ObjectDisposedException.ThrowIf(_buffer == IntPtr.Zero, this);
+        return new Span<byte>(_data, _length);
+    }
+
+    public override MemoryHandle Pin(int elementIndex = 0)
+    {
+        ObjectDisposedException.ThrowIf(_buffer == IntPtr.Zero, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(elementIndex);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(elementIndex, _length);
+
+        // The buffer lives in native memory and never moves
+        return new MemoryHandle(_data + elementIndex);
+    }
+
+    public override void Unpin()
+    {
+        // Nothing to unpin
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        if (_buffer == IntPtr.Zero)
+            return;
+
+        DataPreloaderExporter.CallRelease(_buffer);
+        _buffer = IntPtr.Zero;
+    }
+}
@@ -19,4 +19,6 @@ public static unsafe partial class ArchiveStreamExporter
     private static readonly delegate* unmanaged<IntPtr, IntPtr, int, out int, NativeBool> Read;
     private static readonly delegate* unmanaged<IntPtr, long, SeekOrigin, out long, NativeBool> Seek;
     private static readonly delegate* unmanaged<IntPtr, IntPtr, int, NativeBool> Write;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, long, long> CopyTo;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, long, long> CopyToFileHandle;
 }
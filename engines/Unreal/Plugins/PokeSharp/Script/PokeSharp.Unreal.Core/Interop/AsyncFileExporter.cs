@@ -0,0 +1,15 @@
+﻿using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class AsyncFileExporter
+{
+    private static readonly delegate* unmanaged<IntPtr, IntPtr> OpenRead;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, IntPtr> RequestSize;
+    private static readonly delegate* unmanaged<IntPtr, long, long, IntPtr, NativeBool, IntPtr, IntPtr> RequestRead;
+    private static readonly delegate* unmanaged<IntPtr, void> Cancel;
+    private static readonly delegate* unmanaged<IntPtr, out long, NativeBool> Finish;
+    private static readonly delegate* unmanaged<IntPtr, void> Close;
+}
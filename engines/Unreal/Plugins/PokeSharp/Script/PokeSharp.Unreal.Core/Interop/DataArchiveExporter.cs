@@ -0,0 +1,14 @@
+﻿using PokeSharp.Unreal.Core.Utils;
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class DataArchiveExporter
+{
+    private static readonly delegate* unmanaged<IntPtr, ref SharedPtr, NativeBool> Open;
+    private static readonly delegate* unmanaged<ref SharedPtr, void> Release;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, int, NativeBool> Contains;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, int, IntPtr> OpenEntry;
+}
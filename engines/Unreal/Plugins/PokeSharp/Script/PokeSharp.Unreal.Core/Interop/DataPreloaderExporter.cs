@@ -0,0 +1,11 @@
+﻿using UnrealSharp.Binds;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class DataPreloaderExporter
+{
+    private static readonly delegate* unmanaged<IntPtr, int, out IntPtr, out long, IntPtr> Claim;
+    private static readonly delegate* unmanaged<IntPtr, void> Release;
+    private static readonly delegate* unmanaged<IntPtr, int, void> Discard;
+}
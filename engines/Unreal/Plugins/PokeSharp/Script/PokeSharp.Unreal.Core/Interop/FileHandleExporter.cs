@@ -14,4 +14,6 @@ public static unsafe partial class FileHandleExporter
     private static readonly delegate* unmanaged<IntPtr, long, NativeBool> SetLength;
     private static readonly delegate* unmanaged<IntPtr, IntPtr, int, NativeBool> Write;
     private static readonly delegate* unmanaged<IntPtr, void> Close;
+    private static readonly delegate* unmanaged<IntPtr, FileIOVector*, int, NativeBool> ReadVector;
+    private static readonly delegate* unmanaged<IntPtr, FileIOVector*, int, NativeBool> WriteVector;
 }
@@ -0,0 +1,15 @@
+﻿using System.Runtime.InteropServices;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+/// <summary>
+/// Describes a single range of a batched file read or write. Matches the layout of the native FFileIOVector struct.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct FileIOVector
+{
+    public long Offset;
+    public IntPtr Buffer;
+    public long Length;
+    public long BytesTransferred;
+}
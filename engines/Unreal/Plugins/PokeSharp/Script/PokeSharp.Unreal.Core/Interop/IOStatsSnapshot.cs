@@ -0,0 +1,51 @@
+﻿using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+/// <summary>
+/// The interop surface an I/O operation went through. Matches the native EPokeSharpIOSource enum.
+/// </summary>
+public enum IOSource : byte
+{
+    FileHandle,
+    Archive,
+    SaveGame,
+}
+
+/// <summary>
+/// A histogram of operation latencies using power-of-two microsecond buckets. Bucket 0 holds operations under 1µs,
+/// bucket N holds operations in [2^(N-1), 2^N) µs and the last bucket holds everything slower than that.
+/// </summary>
+[InlineArray(BucketCount)]
+public struct LatencyHistogram
+{
+    public const int BucketCount = 16;
+
+    private long _element;
+}
+
+/// <summary>
+/// A point-in-time copy of a set of I/O counters. Matches the layout of the native FPokeSharpIOSnapshot struct.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct IOStatsSnapshot
+{
+    public long ReadCalls;
+    public long BytesRead;
+    public long WriteCalls;
+    public long BytesWritten;
+    public long SeekCalls;
+    public LatencyHistogram ReadLatency;
+    public LatencyHistogram WriteLatency;
+
+    /// <summary>
+    /// The average number of bytes per read, which is the quickest way to spot serializers issuing many tiny reads.
+    /// </summary>
+    public readonly double AverageReadSize => ReadCalls > 0 ? (double)BytesRead / ReadCalls : 0;
+
+    /// <summary>
+    /// The average number of bytes per write.
+    /// </summary>
+    public readonly double AverageWriteSize => WriteCalls > 0 ? (double)BytesWritten / WriteCalls : 0;
+}
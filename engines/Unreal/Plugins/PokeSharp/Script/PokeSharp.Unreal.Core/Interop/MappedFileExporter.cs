@@ -0,0 +1,10 @@
+﻿using UnrealSharp.Binds;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class MappedFileExporter
+{
+    private static readonly delegate* unmanaged<IntPtr, out IntPtr, out long, IntPtr> Open;
+    private static readonly delegate* unmanaged<IntPtr, void> Close;
+}
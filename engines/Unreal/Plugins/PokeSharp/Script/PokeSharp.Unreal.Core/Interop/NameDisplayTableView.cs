@@ -0,0 +1,16 @@
+﻿using System.Runtime.InteropServices;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+/// <summary>
+/// Describes where the native name display table lives. Matches the layout of the native
+/// FPokeSharpNameDisplayTableView struct.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct NameDisplayTableView
+{
+    public IntPtr Blocks;
+    public IntPtr Generation;
+    public uint BlockCount;
+    public int OffsetBits;
+}
@@ -6,6 +6,7 @@ namespace PokeSharp.Unreal.Core.Interop;
 [NativeCallbacks]
 public static unsafe partial class PlatformFileExporter
 {
-    private static readonly delegate* unmanaged<IntPtr, NativeBool, IntPtr> OpenRead;
-    private static readonly delegate* unmanaged<IntPtr, NativeBool, NativeBool, NativeBool, IntPtr> OpenWrite;
+    private static readonly delegate* unmanaged<IntPtr, NativeBool, int, IntPtr> OpenRead;
+    private static readonly delegate* unmanaged<IntPtr, NativeBool, NativeBool, NativeBool, int, IntPtr> OpenWrite;
+    private static readonly delegate* unmanaged<IntPtr, NativeBool> IsBlockCompressed;
 }
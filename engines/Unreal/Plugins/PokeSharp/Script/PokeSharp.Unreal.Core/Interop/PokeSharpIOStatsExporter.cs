@@ -0,0 +1,12 @@
+﻿using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class PokeSharpIOStatsExporter
+{
+    private static readonly delegate* unmanaged<IOSource, out IOStatsSnapshot, void> GetSnapshot;
+    private static readonly delegate* unmanaged<IntPtr, out IOStatsSnapshot, NativeBool> GetHandleSnapshot;
+    private static readonly delegate* unmanaged<void> Reset;
+}
@@ -14,8 +14,28 @@ public static unsafe partial class PokeSharpNameExporter
         out uint,
         out int,
         void> GetOrAddEntry;
+    private static readonly delegate* unmanaged<
+        IntPtr,
+        int*,
+        int,
+        NativeBool,
+        uint*,
+        uint*,
+        int*,
+        void> GetOrAddEntries;
+    private static readonly delegate* unmanaged<
+        IntPtr,
+        int*,
+        int,
+        NativeBool,
+        uint*,
+        uint*,
+        int*,
+        void> GetOrAddEntriesUtf8;
     private static readonly delegate* unmanaged<uint, uint, NativeBool> IsValid;
     private static readonly delegate* unmanaged<uint, uint, int, IntPtr, int, NativeBool> EqualsBuffer;
     private static readonly delegate* unmanaged<uint, uint, int, ref UnmanagedArray, void> GetString;
+    private static readonly delegate* unmanaged<uint, uint, IntPtr, out NativeBool, int> GetPlainName;
+    private static readonly delegate* unmanaged<out NameDisplayTableView, void> GetDisplayTable;
     private static readonly delegate* unmanaged<FName, out uint, out uint, out int, void> FromUnrealName;
 }
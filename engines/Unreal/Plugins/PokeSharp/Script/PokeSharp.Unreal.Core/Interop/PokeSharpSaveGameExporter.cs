@@ -1,4 +1,5 @@
 ﻿using UnrealSharp.Binds;
+using UnrealSharp.Core;
 
 namespace PokeSharp.Unreal.Core.Interop;
 
@@ -7,4 +8,7 @@ public static unsafe partial class PokeSharpSaveGameExporter
 {
     private static readonly delegate* unmanaged<IntPtr, out IntPtr, out int, void> GetDataReadBuffer;
     private static readonly delegate* unmanaged<IntPtr, IntPtr, int, void> WriteToDataBuffer;
+    private static readonly delegate* unmanaged<IntPtr, int, void> ReserveDataBuffer;
+    private static readonly delegate* unmanaged<IntPtr, int, out IntPtr, out int, void> GetWriteSpan;
+    private static readonly delegate* unmanaged<IntPtr, int, NativeBool> CommitWrite;
 }
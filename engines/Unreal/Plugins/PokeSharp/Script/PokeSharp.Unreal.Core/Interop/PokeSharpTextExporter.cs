@@ -1,4 +1,5 @@
-﻿using UnrealSharp.Binds;
+﻿using PokeSharp.Unreal.Core.Utils;
+using UnrealSharp.Binds;
 using UnrealSharp.Core;
 
 namespace PokeSharp.Unreal.Core.Interop;
@@ -17,6 +18,21 @@ public static unsafe partial class PokeSharpTextExporter
         out FTextData,
         void> FromLocalized;
     private static readonly delegate* unmanaged<IntPtr, int, out FTextData, void> FromLocText;
+    private static readonly delegate* unmanaged<
+        IntPtr,
+        int,
+        IntPtr,
+        int*,
+        IntPtr,
+        int*,
+        int,
+        int*,
+        FTextData*,
+        void> FromLocalizedBatch;
+    private static readonly delegate* unmanaged<FName, IntPtr, int, out FTextData, void> FromStringTable;
+    private static readonly delegate* unmanaged<FName, int> PreloadStringTable;
+    private static readonly delegate* unmanaged<int, out FTextData, NativeBool> FromHandle;
+    private static readonly delegate* unmanaged<IntPtr> GetCultureGeneration;
     private static readonly delegate* unmanaged<ref FTextData, out UnmanagedArray, void> ToLocText;
     private static readonly delegate* unmanaged<ref FTextData, IntPtr> GetSourceString;
     private static readonly delegate* unmanaged<ref FTextData, IntPtr> GetDisplayString;
@@ -29,4 +45,13 @@ public static unsafe partial class PokeSharpTextExporter
     private static readonly delegate* unmanaged<ref FTextData, NativeBool> IsWhitespace;
     private static readonly delegate* unmanaged<ref FTextData, void> Destroy;
     private static readonly delegate* unmanaged<ref FTextData, out IntPtr, out int, void> AsDisplaySpan;
+    private static readonly delegate* unmanaged<
+        ref FTextData,
+        ref SharedPtr,
+        out IntPtr,
+        out int,
+        void> PinDisplayString;
+    private static readonly delegate* unmanaged<ref SharedPtr, void> UnpinDisplayString;
+    private static readonly delegate* unmanaged<FTextData*, int, SharedPtr*, IntPtr*, int*, void> PinDisplayStrings;
+    private static readonly delegate* unmanaged<SharedPtr*, int, void> UnpinDisplayStrings;
 }
@@ -0,0 +1,31 @@
+﻿using PokeSharp.Unreal.Core.Utils;
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class SavePipelineExporter
+{
+    private static readonly delegate* unmanaged<NativeBool> IsContainerSupported;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, IntPtr> CreateRequest;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, int, IntPtr, long, void> AddSection;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, int, double, long, long, IntPtr, int, void> SetSummary;
+    private static readonly delegate* unmanaged<
+        IntPtr,
+        IntPtr,
+        int,
+        int,
+        NativeBool,
+        NativeBool,
+        NativeBool,
+        void> AddPartyIcon;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, NativeBool, void> Submit;
+    private static readonly delegate* unmanaged<IntPtr, float> GetProgress;
+    private static readonly delegate* unmanaged<IntPtr, SaveResult> Finish;
+    private static readonly delegate* unmanaged<IntPtr, ref SharedPtr, NativeBool> OpenContainer;
+    private static readonly delegate* unmanaged<ref SharedPtr, void> ReleaseContainer;
+    private static readonly delegate* unmanaged<IntPtr, int> GetSectionCount;
+    private static readonly delegate* unmanaged<IntPtr, int, out IntPtr, out int, out long, void> GetSectionInfo;
+    private static readonly delegate* unmanaged<IntPtr, IntPtr, int, IntPtr, long, NativeBool> ReadSection;
+}
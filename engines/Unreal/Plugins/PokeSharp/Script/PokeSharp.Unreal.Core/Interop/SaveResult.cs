@@ -0,0 +1,11 @@
+﻿namespace PokeSharp.Unreal.Core.Interop;
+
+/// <summary>
+/// The outcome of a save written by the native save pipeline. Matches the native EPokeSharpSaveResult enum.
+/// </summary>
+public enum SaveResult : byte
+{
+    Succeeded,
+    Failed,
+    NothingToUpdate,
+}
@@ -7,4 +7,5 @@ public static unsafe partial class SettingsChangeExporter
 {
     private static readonly delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> RegisterSettingsChangeCallback;
     private static readonly delegate* unmanaged<IntPtr, void> UnregisterSettingsChangeCallback;
+    private static readonly delegate* unmanaged<out IntPtr, out int, void> GetChangedProperties;
 }
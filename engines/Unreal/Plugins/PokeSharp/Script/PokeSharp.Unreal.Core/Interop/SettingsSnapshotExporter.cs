@@ -0,0 +1,11 @@
+﻿using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class SettingsSnapshotExporter
+{
+    private static readonly delegate* unmanaged<IntPtr, ref UnmanagedArray, void> TakeSnapshot;
+    private static readonly delegate* unmanaged<ref UnmanagedArray, void> ReleaseSnapshot;
+}
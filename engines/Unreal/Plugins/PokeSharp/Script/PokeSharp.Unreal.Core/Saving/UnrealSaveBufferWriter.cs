@@ -0,0 +1,100 @@
+﻿using System.Buffers;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
+using UnrealSharp.PokeSharpCore;
+
+namespace PokeSharp.Unreal.Core.Saving;
+
+/// <summary>
+/// Lets a serializer write straight into the unused capacity at the end of a save game's data buffer, so the save
+/// is built in place instead of being appended to one small chunk at a time.
+/// </summary>
+public sealed unsafe class UnrealSaveBufferWriter(UPokeSharpSaveGame saveGame) : IBufferWriter<byte>
+{
+    private const int MinimumSegmentSize = 4096;
+
+    private readonly NativeSegment _segment = new();
+
+    /// <summary>
+    /// Makes sure the save game can hold at least the given number of bytes without reallocating.
+    /// </summary>
+    /// <param name="capacity">The number of bytes to reserve.</param>
+    public void Reserve(int capacity)
+    {
+        PokeSharpSaveGameExporter.CallReserveDataBuffer(saveGame.NativeObject, capacity);
+    }
+
+    public void Advance(int count)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(count);
+        if (!PokeSharpSaveGameExporter.CallCommitWrite(saveGame.NativeObject, count).ToManagedBool())
+        {
+            throw new InvalidOperationException("Cannot advance past the end of the buffer");
+        }
+    }
+
+    public Memory<byte> GetMemory(int sizeHint = 0)
+    {
+        var (buffer, length) = GetWriteSpan(sizeHint);
+        _segment.Reset(buffer, length);
+        return _segment.Memory;
+    }
+
+    public Span<byte> GetSpan(int sizeHint = 0)
+    {
+        var (buffer, length) = GetWriteSpan(sizeHint);
+        return new Span<byte>(buffer, length);
+    }
+
+    private (byte* Buffer, int Length) GetWriteSpan(int sizeHint)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(sizeHint);
+        PokeSharpSaveGameExporter.CallGetWriteSpan(
+            saveGame.NativeObject,
+            Math.Max(sizeHint, MinimumSegmentSize),
+            out var buffer,
+            out var length
+        );
+        return ((byte*)buffer, length);
+    }
+
+    /// <summary>
+    /// Exposes the current write span as <see cref="Memory{T}"/>. The same instance is reused for every call to
+    /// <see cref="GetMemory"/>, since the previous memory is invalidated by <see cref="Advance"/> anyway.
+    /// </summary>
+    private sealed class NativeSegment : MemoryManager<byte>
+    {
+        private byte* _buffer;
+        private int _length;
+
+        public void Reset(byte* buffer, int length)
+        {
+            _buffer = buffer;
+            _length = length;
+        }
+
+        public override Span<byte> GetSpan()
+        {
+            return new Span<byte>(_buffer, _length);
+        }
+
+        public override MemoryHandle Pin(int elementIndex = 0)
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(elementIndex);
+            ArgumentOutOfRangeException.ThrowIfGreaterThan(elementIndex, _length);
+
+            // The save game's buffer is native memory, so it never moves
+            return new MemoryHandle(_buffer + elementIndex);
+        }
+
+        public override void Unpin()
+        {
+            // Nothing to unpin
+        }
+
+        protected override void Dispose(bool disposing)
+        {
+            // The memory is owned by the save game
+        }
+    }
+}
@@ -0,0 +1,108 @@
+﻿using PokeSharp.Core.Strings;
+using PokeSharp.Unreal.Core.Interop;
+using PokeSharp.Unreal.Core.Utils;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Saving;
+
+/// <summary>
+/// A save slot written by the native save pipeline, holding one section per save value. Only the section directory is
+/// read when the container is opened, each section is read from the file when it is asked for.
+/// </summary>
+public sealed unsafe class UnrealSaveContainer : IDisposable
+{
+    private SharedPtr _container;
+    private readonly Dictionary<Name, long> _sectionSizes;
+
+    private UnrealSaveContainer(SharedPtr container)
+    {
+        _container = container;
+
+        var sectionCount = SavePipelineExporter.CallGetSectionCount(container.Pointer);
+        _sectionSizes = new Dictionary<Name, long>(sectionCount);
+        for (var i = 0; i < sectionCount; i++)
+        {
+            SavePipelineExporter.CallGetSectionInfo(
+                container.Pointer,
+                i,
+                out var name,
+                out var nameLength,
+                out var size
+            );
+            _sectionSizes[new Name(new ReadOnlySpan<char>((char*)name, nameLength))] = size;
+        }
+    }
+
+    ~UnrealSaveContainer()
+    {
+        Dispose(false);
+    }
+
+    /// <summary>
+    /// The IDs of every section in the container.
+    /// </summary>
+    public IReadOnlyCollection<Name> SectionIds => _sectionSizes.Keys;
+
+    /// <summary>
+    /// Attempts to open the save container in the given slot, waiting for any save to it that is still in flight.
+    /// </summary>
+    /// <param name="slotName">The name of the save slot.</param>
+    /// <returns>The opened container, or <see langword="null"/> if the slot does not hold a container.</returns>
+    public static UnrealSaveContainer? TryOpen(ReadOnlySpan<char> slotName)
+    {
+        var container = new SharedPtr();
+        fixed (char* slotNamePtr = slotName)
+        {
+            if (!SavePipelineExporter.CallOpenContainer((IntPtr)slotNamePtr, ref container).ToManagedBool())
+            {
+                return null;
+            }
+        }
+
+        return new UnrealSaveContainer(container);
+    }
+
+    /// <summary>
+    /// Reads and verifies the contents of a single section.
+    /// </summary>
+    /// <param name="id">The ID of the section.</param>
+    /// <returns>The uncompressed contents of the section.</returns>
+    public byte[] ReadSection(Name id)
+    {
+        ObjectDisposedException.ThrowIf(_container.Pointer == IntPtr.Zero, this);
+        if (!_sectionSizes.TryGetValue(id, out var size))
+            throw new KeyNotFoundException($"Save section {id} does not exist");
+
+        var buffer = GC.AllocateUninitializedArray<byte>(checked((int)size));
+        var name = id.ToString();
+        fixed (char* namePtr = name)
+        fixed (byte* bufferPtr = buffer)
+        {
+            if (
+                !SavePipelineExporter
+                    .CallReadSection(_container.Pointer, (IntPtr)namePtr, name.Length, (IntPtr)bufferPtr, size)
+                    .ToManagedBool()
+            )
+            {
+                throw new InvalidDataException($"Save section {id} is corrupt");
+            }
+        }
+
+        return buffer;
+    }
+
+    public void Dispose()
+    {
+        Dispose(true);
+        GC.SuppressFinalize(this);
+    }
+
+    private void Dispose(bool disposing)
+    {
+        if (_container.Pointer == IntPtr.Zero)
+            return;
+
+        SavePipelineExporter.CallReleaseContainer(ref _container);
+        _container = default;
+    }
+}
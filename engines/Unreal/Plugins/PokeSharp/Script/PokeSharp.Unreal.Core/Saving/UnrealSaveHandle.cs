@@ -1,4 +1,9 @@
-﻿using PokeSharp.Core.Saving;
+﻿using System.Buffers;
+using System.Runtime.InteropServices;
+using PokeSharp.Core.Saving;
+using PokeSharp.Core.Strings;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
 using UnrealSharp.Engine;
 using UnrealSharp.PokeSharpCore;
 
@@ -19,19 +24,58 @@ public sealed class UnrealSaveReadHandle(UPokeSharpSaveGame saveGame) : ISaveRea
     }
 }
 
-public sealed class UnrealSaveWriteHandle(UPokeSharpSaveGame saveGame, string slotName, int userIndex)
-    : ISaveWriteHandle
+public sealed class UnrealSaveWriteHandle : IBufferedSaveWriteHandle
 {
-    public Stream Stream { get; } = new UnrealSaveStream(saveGame, true);
+    private readonly UPokeSharpSaveGame _saveGame;
+    private readonly string _slotName;
+    private readonly int _userIndex;
+    private readonly Action<int>? _onCommitted;
+
+    /// <summary>
+    /// Creates a new write handle.
+    /// </summary>
+    /// <param name="saveGame">The save game to write into.</param>
+    /// <param name="slotName">The slot to save to when committed.</param>
+    /// <param name="userIndex">The user the slot belongs to.</param>
+    /// <param name="sizeHint">The expected size of the save, usually taken from the previous one.</param>
+    /// <param name="onCommitted">Invoked with the final size of the save once it has been committed.</param>
+    public UnrealSaveWriteHandle(
+        UPokeSharpSaveGame saveGame,
+        string slotName,
+        int userIndex,
+        int sizeHint = 0,
+        Action<int>? onCommitted = null
+    )
+    {
+        _saveGame = saveGame;
+        _slotName = slotName;
+        _userIndex = userIndex;
+        _onCommitted = onCommitted;
+        Stream = new UnrealSaveStream(saveGame, true);
+
+        var bufferWriter = new UnrealSaveBufferWriter(saveGame);
+        if (sizeHint > 0)
+        {
+            bufferWriter.Reserve(sizeHint);
+        }
+
+        BufferWriter = bufferWriter;
+    }
+
+    public Stream Stream { get; }
+
+    public IBufferWriter<byte> BufferWriter { get; }
 
     public void Commit()
     {
-        UGameplayStatics.SaveGameToSlot(saveGame, slotName, userIndex);
+        UGameplayStatics.SaveGameToSlot(_saveGame, _slotName, _userIndex);
+        _onCommitted?.Invoke(_saveGame.DataSize);
     }
 
     public async ValueTask CommitAsync(CancellationToken cancellationToken = default)
     {
-        await UGameplayStatics.SaveGameToSlotAsync(saveGame, slotName, userIndex);
+        await UGameplayStatics.SaveGameToSlotAsync(_saveGame, _slotName, _userIndex);
+        _onCommitted?.Invoke(_saveGame.DataSize);
     }
 
     public void Dispose()
@@ -44,3 +88,195 @@ public sealed class UnrealSaveWriteHandle(UPokeSharpSaveGame saveGame, string sl
         await Stream.DisposeAsync();
     }
 }
+
+public sealed class UnrealSectionedSaveReadHandle(UnrealSaveContainer container) : ISectionedSaveReadHandle
+{
+    public Stream Stream => throw new NotSupportedException("Sectioned saves are read one section at a time");
+
+    public IReadOnlyCollection<Name> SectionIds => container.SectionIds;
+
+    public ReadOnlyMemory<byte> ReadSection(Name id)
+    {
+        return container.ReadSection(id);
+    }
+
+    public void Dispose()
+    {
+        container.Dispose();
+    }
+
+    public ValueTask DisposeAsync()
+    {
+        container.Dispose();
+        return ValueTask.CompletedTask;
+    }
+}
+
+/// <summary>
+/// Hands the sections of a save to the native save pipeline, which compresses and writes them on worker threads.
+/// </summary>
+public sealed class UnrealSectionedSaveWriteHandle : ISectionedSaveWriteHandle
+{
+    private readonly string _slotName;
+    private readonly TaskCompletionSource _completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+    private IntPtr _request;
+    private IProgress<float>? _progress;
+    private bool _submitted;
+
+    /// <summary>
+    /// Creates a new write handle.
+    /// </summary>
+    /// <param name="slotName">The slot to save to when committed.</param>
+    public UnrealSectionedSaveWriteHandle(string slotName)
+    {
+        _slotName = slotName;
+
+        // Ownership of both GC handles passes to the native request, which frees them once finished
+        var progressHandle = GCHandle.Alloc((Action)ReportProgress);
+        var completionHandle = GCHandle.Alloc((Action)(() => _completion.TrySetResult()));
+        _request = SavePipelineExporter.CallCreateRequest(
+            GCHandle.ToIntPtr(progressHandle),
+            GCHandle.ToIntPtr(completionHandle)
+        );
+    }
+
+    public Stream Stream => throw new NotSupportedException("Sectioned saves are written one section at a time");
+
+    public bool KeepUnwrittenSections { get; set; }
+
+    public bool UnwrittenSectionsMissing { get; private set; }
+
+    public unsafe void WriteSection(Name id, ReadOnlySpan<byte> data)
+    {
+        ObjectDisposedException.ThrowIf(_request == IntPtr.Zero, this);
+        if (_submitted)
+            throw new InvalidOperationException("The save has already been committed");
+
+        var name = id.ToString();
+        fixed (char* namePtr = name)
+        fixed (byte* dataPtr = data)
+        {
+            SavePipelineExporter.CallAddSection(_request, (IntPtr)namePtr, name.Length, (IntPtr)dataPtr, data.Length);
+        }
+    }
+
+    public unsafe void WriteSummary(SaveSlotSummary summary)
+    {
+        ObjectDisposedException.ThrowIf(_request == IntPtr.Zero, this);
+        if (_submitted)
+            throw new InvalidOperationException("The save has already been committed");
+
+        // Both clocks count 100ns ticks from the start of year 1, so the timestamp carries over unchanged
+        fixed (char* playerNamePtr = summary.PlayerName)
+        fixed (char* gameVersionPtr = summary.GameVersion)
+        {
+            SavePipelineExporter.CallSetSummary(
+                _request,
+                (IntPtr)playerNamePtr,
+                summary.PlayerName.Length,
+                summary.PlayTime.TotalSeconds,
+                unchecked((long)summary.Badges),
+                summary.Timestamp.UtcTicks,
+                (IntPtr)gameVersionPtr,
+                summary.GameVersion.Length
+            );
+        }
+
+        foreach (var icon in summary.Party)
+        {
+            var species = icon.Species.ToString();
+            fixed (char* speciesPtr = species)
+            {
+                SavePipelineExporter.CallAddPartyIcon(
+                    _request,
+                    (IntPtr)speciesPtr,
+                    species.Length,
+                    icon.Form,
+                    icon.Shiny.ToNativeBool(),
+                    icon.Female.ToNativeBool(),
+                    icon.Egg.ToNativeBool()
+                );
+            }
+        }
+    }
+
+    public void Commit()
+    {
+        Commit(null);
+    }
+
+    public void Commit(IProgress<float>? progress)
+    {
+        Submit(progress);
+
+        // Blocks on the task itself, since a continuation of CommitAsync could be posted back to this very thread
+        _completion.Task.GetAwaiter().GetResult();
+        Finish();
+    }
+
+    public ValueTask CommitAsync(CancellationToken cancellationToken = default)
+    {
+        return CommitAsync(null, cancellationToken);
+    }
+
+    public async ValueTask CommitAsync(IProgress<float>? progress, CancellationToken cancellationToken = default)
+    {
+        cancellationToken.ThrowIfCancellationRequested();
+        Submit(progress);
+
+        // Once submitted the write always runs to completion, so the slot is never left half-written by a cancellation
+        await _completion.Task;
+        Finish();
+    }
+
+    private void Submit(IProgress<float>? progress)
+    {
+        ObjectDisposedException.ThrowIf(_request == IntPtr.Zero, this);
+        if (_submitted)
+            throw new InvalidOperationException("The save has already been committed");
+
+        _progress = progress;
+        _submitted = true;
+        unsafe
+        {
+            fixed (char* slotNamePtr = _slotName)
+            {
+                SavePipelineExporter.CallSubmit(
+                    _request,
+                    (IntPtr)slotNamePtr,
+                    KeepUnwrittenSections.ToNativeBool()
+                );
+            }
+        }
+    }
+
+    private void Finish()
+    {
+        var result = SavePipelineExporter.CallFinish(_request);
+        _request = IntPtr.Zero;
+        UnwrittenSectionsMissing = result == SaveResult.NothingToUpdate;
+        if (result == SaveResult.Failed)
+            throw new IOException($"Failed to write save to slot {_slotName}");
+    }
+
+    public void Dispose()
+    {
+        // A submitted request is freed by the commit once the pipeline is done with it
+        if (_request == IntPtr.Zero || _submitted)
+            return;
+
+        SavePipelineExporter.CallFinish(_request);
+        _request = IntPtr.Zero;
+    }
+
+    public ValueTask DisposeAsync()
+    {
+        Dispose();
+        return ValueTask.CompletedTask;
+    }
+
+    private void ReportProgress()
+    {
+        _progress?.Report(SavePipelineExporter.CallGetProgress(_request));
+    }
+}
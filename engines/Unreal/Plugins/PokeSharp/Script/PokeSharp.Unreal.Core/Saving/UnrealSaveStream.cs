@@ -7,6 +7,7 @@ namespace PokeSharp.Unreal.Core.Saving;
 public sealed class UnrealSaveStream(UPokeSharpSaveGame saveGame, bool writeMode) : Stream
 {
     private readonly TStrongObjectPtr<UPokeSharpSaveGame> _saveGame = saveGame;
+    private readonly UnrealSaveBufferWriter? _writer = writeMode ? new UnrealSaveBufferWriter(saveGame) : null;
     private bool _disposed;
 
     public override bool CanRead => !writeMode;
@@ -82,18 +83,22 @@ public sealed class UnrealSaveStream(UPokeSharpSaveGame saveGame, bool writeMode
         throw new NotSupportedException("Cannot set length of save stream.");
     }
 
-    public override unsafe void Write(byte[] buffer, int offset, int count)
+    public override void Write(byte[] buffer, int offset, int count)
     {
-        if (!CanWrite)
+        Write(buffer.AsSpan(offset, count));
+    }
+
+    public override void Write(ReadOnlySpan<byte> buffer)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (_writer is null)
             throw new IOException("This stream is not writable.");
         if (_saveGame.Value is null)
             throw new InvalidOperationException("Save game is not loaded.");
 
-        var writeSpan = buffer.AsSpan(offset, count);
-        fixed (byte* writePtr = writeSpan)
-        {
-            PokeSharpSaveGameExporter.CallWriteToDataBuffer(_saveGame.Value.NativeObject, (IntPtr)writePtr, count);
-        }
+        // Copy straight into the save game's spare capacity rather than having it append a fresh chunk every time
+        buffer.CopyTo(_writer.GetSpan(buffer.Length));
+        _writer.Advance(buffer.Length);
     }
 
     protected override void Dispose(bool disposing)
@@ -1,4 +1,6 @@
-﻿using PokeSharp.Core.Saving;
+﻿using System.Collections.Concurrent;
+using PokeSharp.Core.Saving;
+using PokeSharp.Unreal.Core.Interop;
 using UnrealSharp;
 using UnrealSharp.Engine;
 using UnrealSharp.PokeSharpCore;
@@ -10,6 +12,16 @@ public class UnrealSaveSystem : ISaveSystem
 {
     private const int UserIndex = 0;
 
+    private readonly ConcurrentDictionary<string, int> _sizeHints = new();
+
+    /// <summary>
+    /// Whether slots are written as save containers through the save pipeline. Platforms with their own save game
+    /// system keep writing every slot as a <see cref="UPokeSharpSaveGame"/>, so each platform only uses one format.
+    /// </summary>
+    private readonly bool _useContainers = SavePipelineExporter.CallIsContainerSupported().ToManagedBool();
+
+    public bool VerifiesIntegrity => true;
+
     public bool Exists(string filePath)
     {
         return UGameplayStatics.DoesSaveGameExist(filePath, UserIndex);
@@ -17,9 +29,12 @@ public class UnrealSaveSystem : ISaveSystem
 
     public ISaveReadHandle OpenRead(string filePath)
     {
+        if (_useContainers && UnrealSaveContainer.TryOpen(filePath) is { } container)
+            return new UnrealSectionedSaveReadHandle(container);
+
         var saveData = UGameplayStatics.LoadGameFromSlot(filePath, UserIndex);
         return saveData is UPokeSharpSaveGame pokeSharpSaveGame
-            ? new UnrealSaveReadHandle(pokeSharpSaveGame)
+            ? OpenLoadedSave(filePath, pokeSharpSaveGame)
             : throw new InvalidOperationException("Save data is not a PokeSharp save game");
     }
 
@@ -28,27 +43,58 @@ public class UnrealSaveSystem : ISaveSystem
         CancellationToken cancellationToken = default
     )
     {
+        if (_useContainers && UnrealSaveContainer.TryOpen(filePath) is { } container)
+            return new UnrealSectionedSaveReadHandle(container);
+
         var saveData = await UGameplayStatics.LoadGameFromSlotAsync(filePath, UserIndex);
         return saveData is UPokeSharpSaveGame pokeSharpSaveGame
-            ? new UnrealSaveReadHandle(pokeSharpSaveGame)
+            ? OpenLoadedSave(filePath, pokeSharpSaveGame)
             : throw new InvalidOperationException("Save data is not a PokeSharp save game");
     }
 
     public ISaveWriteHandle OpenWrite(string filePath)
     {
-        var saveData = UPokeSharpSaveGame.CreateSaveGame();
-        return new UnrealSaveWriteHandle(saveData, filePath, UserIndex);
+        // Synchronous saves go through the save pipeline as well, so they queue behind any save to the slot that is
+        // still being written, and committing just blocks until the pipeline is done
+        return _useContainers ? new UnrealSectionedSaveWriteHandle(filePath) : OpenSaveGameWrite(filePath);
     }
 
     public ValueTask<ISaveWriteHandle> OpenWriteAsync(string filePath, CancellationToken cancellationToken = default)
     {
-        return ValueTask.FromResult(OpenWrite(filePath));
+        // Asynchronous saves go through the save pipeline, so only serializing the values happens on the game thread
+        return ValueTask.FromResult(
+            _useContainers ? new UnrealSectionedSaveWriteHandle(filePath) : OpenSaveGameWrite(filePath)
+        );
+    }
+
+    private ISaveWriteHandle OpenSaveGameWrite(string filePath)
+    {
+        var saveData = UPokeSharpSaveGame.CreateSaveGame();
+
+        // Saves rarely change size much between writes, so reserving the previous size avoids growing the buffer
+        var sizeHint = _sizeHints.GetValueOrDefault(filePath);
+        return new UnrealSaveWriteHandle(
+            saveData,
+            filePath,
+            UserIndex,
+            sizeHint + sizeHint / 8,
+            size => _sizeHints[filePath] = size
+        );
+    }
+
+    private UnrealSaveReadHandle OpenLoadedSave(string filePath, UPokeSharpSaveGame saveGame)
+    {
+        if (saveGame.IsCorrupt())
+            throw new InvalidDataException($"Save {filePath} failed its integrity check");
+
+        _sizeHints[filePath] = saveGame.DataSize;
+        return new UnrealSaveReadHandle(saveGame);
     }
 
     public void Copy(string sourceFilePath, string destinationFilePath)
     {
-        var saveData = UGameplayStatics.LoadGameFromSlot(sourceFilePath, UserIndex);
-        UGameplayStatics.SaveGameToSlot(saveData, destinationFilePath, UserIndex);
+        if (!UGameplayStatics.CopySaveSlot(sourceFilePath, destinationFilePath, UserIndex))
+            throw new IOException($"Failed to copy save {sourceFilePath} to {destinationFilePath}");
     }
 
     public async ValueTask CopyAsync(
@@ -57,22 +103,21 @@ public class UnrealSaveSystem : ISaveSystem
         CancellationToken cancellationToken = default
     )
     {
-        var saveData = await UGameplayStatics
-            .LoadGameFromSlotAsync(sourceFilePath, UserIndex)
-            .ConfigureWithUnrealContext();
-        await UGameplayStatics
-            .SaveGameToSlotAsync(saveData, destinationFilePath, UserIndex)
+        // The slot is copied byte for byte on a worker thread, nothing is loaded or serialized again
+        var copied = await UGameplayStatics
+            .CopySaveSlotAsync(sourceFilePath, destinationFilePath, UserIndex)
             .ConfigureWithUnrealContext();
+        if (!copied)
+            throw new IOException($"Failed to copy save {sourceFilePath} to {destinationFilePath}");
     }
 
     public void Delete(string filePath)
     {
-        UGameplayStatics.DeleteGameInSlot(filePath, UserIndex);
+        UGameplayStatics.DeleteSaveSlot(filePath, UserIndex);
     }
 
-    public ValueTask DeleteAsync(string filePath, CancellationToken cancellationToken = default)
+    public async ValueTask DeleteAsync(string filePath, CancellationToken cancellationToken = default)
     {
-        Delete(filePath);
-        return ValueTask.CompletedTask;
+        await UGameplayStatics.DeleteSaveSlotAsync(filePath, UserIndex).ConfigureWithUnrealContext();
     }
 }
@@ -1,4 +1,5 @@
-﻿using PokeSharp.Unreal.Core.Interop;
+﻿using PokeSharp.Unreal.Core.FileSystem;
+using PokeSharp.Unreal.Core.Interop;
 using PokeSharp.Unreal.Core.Utils;
 using UnrealSharp.Core;
 
@@ -121,6 +122,66 @@ public sealed class ArchiveStream : Stream
         }
     }
 
+    /// <inheritdoc />
+    /// <remarks>
+    /// When the destination is another archive or a native file, the data is copied entirely on the native side
+    /// without passing through managed memory. The buffer size is ignored in that case.
+    /// </remarks>
+    public override void CopyTo(Stream destination, int bufferSize)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        long copied;
+        switch (destination)
+        {
+            case ArchiveStream archiveStream:
+                ObjectDisposedException.ThrowIf(archiveStream._disposed, archiveStream);
+                copied = ArchiveStreamExporter.CallCopyTo(_archive.Pointer, archiveStream._archive.Pointer, IndexNone);
+                break;
+            case UnrealFileSystemStream fileStream:
+                copied = ArchiveStreamExporter.CallCopyToFileHandle(
+                    _archive.Pointer,
+                    fileStream.FileHandle,
+                    IndexNone
+                );
+                break;
+            default:
+                base.CopyTo(destination, bufferSize);
+                return;
+        }
+
+        if (copied == IndexNone)
+        {
+            throw new IOException("Failed to copy archive stream");
+        }
+    }
+
+    /// <inheritdoc />
+    /// <remarks>
+    /// Native destinations are copied synchronously, as described in <see cref="CopyTo(Stream, int)"/>.
+    /// </remarks>
+    public override Task CopyToAsync(Stream destination, int bufferSize, CancellationToken cancellationToken)
+    {
+        if (destination is not (ArchiveStream or UnrealFileSystemStream))
+        {
+            return base.CopyToAsync(destination, bufferSize, cancellationToken);
+        }
+
+        if (cancellationToken.IsCancellationRequested)
+        {
+            return Task.FromCanceled(cancellationToken);
+        }
+
+        try
+        {
+            CopyTo(destination, bufferSize);
+            return Task.CompletedTask;
+        }
+        catch (Exception e)
+        {
+            return Task.FromException(e);
+        }
+    }
+
     protected override void Dispose(bool disposing)
     {
         if (_disposed)
@@ -0,0 +1,65 @@
+﻿using PokeSharp.Unreal.Core.Interop;
+
+namespace PokeSharp.Unreal.Core.Strings;
+
+/// <summary>
+/// Reads the display strings that native code has copied into the append-only name display table, without calling
+/// back into native code.
+/// </summary>
+/// <remarks>
+/// Every name handed out by the name exporter has its display string published to the table before the call returns,
+/// so a miss only happens for names that reached managed code some other way, such as a bit-cast <c>FName</c>.
+/// </remarks>
+internal sealed unsafe class NameDisplayTable
+{
+    private readonly nint* _blocks;
+    private readonly uint* _generation;
+    private readonly uint _blockCount;
+    private readonly int _offsetBits;
+    private readonly uint _offsetMask;
+
+    public NameDisplayTable()
+    {
+        PokeSharpNameExporter.CallGetDisplayTable(out var view);
+        _blocks = (nint*)view.Blocks;
+        _generation = (uint*)view.Generation;
+        _blockCount = view.BlockCount;
+        _offsetBits = view.OffsetBits;
+        _offsetMask = (1u << view.OffsetBits) - 1;
+    }
+
+    /// <summary>
+    /// Gets a value that changes every time a new display string is added to the table.
+    /// </summary>
+    public uint Generation => Volatile.Read(ref *_generation);
+
+    /// <summary>
+    /// Tries to get the characters of the display string with the given index.
+    /// </summary>
+    /// <param name="displayIndex">The display index of the name.</param>
+    /// <param name="displayString">
+    /// The characters of the display string, not including the number suffix. The memory is owned by the table and
+    /// stays valid for the lifetime of the process.
+    /// </param>
+    /// <returns>Whether the display string has been published to the table.</returns>
+    public bool TryGetDisplayString(uint displayIndex, out ReadOnlySpan<char> displayString)
+    {
+        var block = displayIndex >> _offsetBits;
+        if (block < _blockCount)
+        {
+            var slots = (nint*)Volatile.Read(ref _blocks[block]);
+            if (slots is not null)
+            {
+                var entry = (char*)Volatile.Read(ref slots[displayIndex & _offsetMask]);
+                if (entry is not null)
+                {
+                    displayString = new ReadOnlySpan<char>(entry + 1, entry[0]);
+                    return true;
+                }
+            }
+        }
+
+        displayString = default;
+        return false;
+    }
+}
@@ -0,0 +1,40 @@
+﻿using PokeSharp.Unreal.Core.Interop;
+using PokeSharp.Unreal.Core.Utils;
+
+namespace PokeSharp.Unreal.Core.Strings;
+
+/// <summary>
+/// The characters of a text's display string, which stay valid until the pin is disposed even if the culture changes
+/// in the meantime.
+/// </summary>
+/// <remarks>
+/// The pin holds a shared reference to the native display string, so it has to be disposed exactly once, and copies
+/// of it must not outlive the original.
+/// </remarks>
+public ref struct PinnedDisplayString : IDisposable
+{
+    private SharedPtr _pin;
+
+    internal PinnedDisplayString(ReadOnlySpan<char> span, SharedPtr pin = default)
+    {
+        Span = span;
+        _pin = pin;
+    }
+
+    /// <summary>
+    /// The characters of the display string.
+    /// </summary>
+    public ReadOnlySpan<char> Span { get; private set; }
+
+    /// <inheritdoc />
+    public void Dispose()
+    {
+        if (_pin.Pointer != IntPtr.Zero)
+        {
+            PokeSharpTextExporter.CallUnpinDisplayString(ref _pin);
+        }
+
+        _pin = default;
+        Span = default;
+    }
+}
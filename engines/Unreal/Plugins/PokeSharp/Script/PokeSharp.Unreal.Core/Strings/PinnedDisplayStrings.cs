@@ -0,0 +1,144 @@
+﻿using System.Buffers;
+using PokeSharp.Core.Strings;
+using PokeSharp.Unreal.Core.Interop;
+using PokeSharp.Unreal.Core.Utils;
+using UnrealSharp.Core;
+
+namespace PokeSharp.Unreal.Core.Strings;
+
+/// <summary>
+/// The display strings of a batch of texts, such as every line of a menu, pinned in a single native call. Every span
+/// stays valid until the batch is disposed, even if the culture changes in the meantime.
+/// </summary>
+public sealed unsafe class PinnedDisplayStrings : IDisposable
+{
+    private readonly int _count;
+    private readonly int _nativeCount;
+    private SharedPtr[]? _pins;
+    private IntPtr[]? _buffers;
+    private int[]? _lengths;
+    private int[]? _slots;
+    private string?[]? _managedStrings;
+
+    private PinnedDisplayStrings(ReadOnlySpan<Text> texts)
+    {
+        _count = texts.Length;
+        _pins = ArrayPool<SharedPtr>.Shared.Rent(_count);
+        _buffers = ArrayPool<IntPtr>.Shared.Rent(_count);
+        _lengths = ArrayPool<int>.Shared.Rent(_count);
+        _slots = ArrayPool<int>.Shared.Rent(_count);
+        _managedStrings = ArrayPool<string?>.Shared.Rent(_count);
+
+        // The native texts are copied without touching their reference counts, which is fine since the texts
+        // themselves keep them alive for the duration of the call
+        var textData = ArrayPool<FTextData>.Shared.Rent(_count);
+        try
+        {
+            for (var i = 0; i < _count; i++)
+            {
+                if (texts[i].Data is UnrealTextData unrealText)
+                {
+                    textData[_nativeCount] = unrealText.NativeData;
+                    _slots[i] = _nativeCount++;
+                    _managedStrings[i] = null;
+                }
+                else
+                {
+                    // Managed display strings are already safe to hold onto
+                    _slots[i] = -1;
+                    _managedStrings[i] = texts[i].ToString();
+                }
+            }
+
+            fixed (FTextData* textDataPtr = textData)
+            fixed (SharedPtr* pinsPtr = _pins)
+            fixed (IntPtr* buffersPtr = _buffers)
+            fixed (int* lengthsPtr = _lengths)
+            {
+                PokeSharpTextExporter.CallPinDisplayStrings(
+                    textDataPtr,
+                    _nativeCount,
+                    pinsPtr,
+                    buffersPtr,
+                    lengthsPtr
+                );
+            }
+        }
+        finally
+        {
+            ArrayPool<FTextData>.Shared.Return(textData, true);
+        }
+    }
+
+    ~PinnedDisplayStrings()
+    {
+        Dispose(false);
+    }
+
+    /// <summary>
+    /// The number of display strings in the batch.
+    /// </summary>
+    public int Count => _count;
+
+    /// <summary>
+    /// Gets the characters of the display string of the text at the given index.
+    /// </summary>
+    /// <param name="index">The index of the text in the batch.</param>
+    public ReadOnlySpan<char> this[int index]
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(_slots is null, this);
+            ArgumentOutOfRangeException.ThrowIfNegative(index);
+            ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(index, _count);
+
+            var slot = _slots[index];
+            return slot >= 0
+                ? new ReadOnlySpan<char>((char*)_buffers![slot], _lengths![slot])
+                : _managedStrings![index].AsSpan();
+        }
+    }
+
+    /// <summary>
+    /// Pins the display strings of the given texts.
+    /// </summary>
+    /// <param name="texts">The texts to pin.</param>
+    /// <returns>The pinned display strings, in the same order as the texts.</returns>
+    public static PinnedDisplayStrings Pin(ReadOnlySpan<Text> texts)
+    {
+        return new PinnedDisplayStrings(texts);
+    }
+
+    /// <inheritdoc />
+    public void Dispose()
+    {
+        Dispose(true);
+        GC.SuppressFinalize(this);
+    }
+
+    private void Dispose(bool disposing)
+    {
+        if (_pins is null)
+            return;
+
+        fixed (SharedPtr* pinsPtr = _pins)
+        {
+            PokeSharpTextExporter.CallUnpinDisplayStrings(pinsPtr, _nativeCount);
+        }
+
+        if (disposing)
+        {
+            ArrayPool<SharedPtr>.Shared.Return(_pins, true);
+            ArrayPool<IntPtr>.Shared.Return(_buffers!);
+            ArrayPool<int>.Shared.Return(_lengths!);
+            ArrayPool<int>.Shared.Return(_slots!);
+            ArrayPool<string?>.Shared.Return(_managedStrings!, true);
+        }
+
+        _pins = null;
+        _buffers = null;
+        _lengths = null;
+        _slots = null;
+        _managedStrings = null;
+    }
+}
@@ -1,12 +1,25 @@
-﻿using PokeSharp.Core.Strings;
+﻿using System.Globalization;
+using System.Runtime.InteropServices;
+using PokeSharp.Core.Strings;
 using PokeSharp.Unreal.Core.Interop;
 using UnrealSharp.Core;
-using UnrealSharp.Core.Marshallers;
 
 namespace PokeSharp.Unreal.Core.Strings;
 
 internal unsafe class UnrealNameProvider : INameProvider
 {
+    /// <summary>
+    /// The maximum length of a name entry. Matches NAME_SIZE.
+    /// </summary>
+    private const int NameSize = 1024;
+
+    /// <summary>
+    /// Room for the longest name entry, the separating underscore and a full <see cref="int"/> suffix.
+    /// </summary>
+    private const int MaxDisplayLength = NameSize + 12;
+
+    private readonly NameDisplayTable _displayTable = new();
+
     public (uint ComparisonIndex, uint DisplayIndex, int Number) GetOrAddEntry(
         ReadOnlySpan<char> value,
         FindName findType
@@ -26,6 +39,72 @@ internal unsafe class UnrealNameProvider : INameProvider
         }
     }
 
+    public void GetOrAddEntries(
+        ReadOnlySpan<char> buffer,
+        ReadOnlySpan<int> offsets,
+        FindName findType,
+        Span<uint> comparisonIndices,
+        Span<uint> displayIndices,
+        Span<int> numbers
+    )
+    {
+        var count = offsets.Length - 1;
+        if (count <= 0)
+            return;
+
+        ValidateBatchOutputs(count, comparisonIndices, displayIndices, numbers);
+
+        fixed (char* bufferPtr = buffer)
+        fixed (int* offsetsPtr = offsets)
+        fixed (uint* comparisonIndicesPtr = comparisonIndices)
+        fixed (uint* displayIndicesPtr = displayIndices)
+        fixed (int* numbersPtr = numbers)
+        {
+            PokeSharpNameExporter.CallGetOrAddEntries(
+                (IntPtr)bufferPtr,
+                offsetsPtr,
+                count,
+                findType == FindName.Find ? NativeBool.True : NativeBool.False,
+                comparisonIndicesPtr,
+                displayIndicesPtr,
+                numbersPtr
+            );
+        }
+    }
+
+    public void GetOrAddEntries(
+        ReadOnlySpan<byte> utf8Buffer,
+        ReadOnlySpan<int> offsets,
+        FindName findType,
+        Span<uint> comparisonIndices,
+        Span<uint> displayIndices,
+        Span<int> numbers
+    )
+    {
+        var count = offsets.Length - 1;
+        if (count <= 0)
+            return;
+
+        ValidateBatchOutputs(count, comparisonIndices, displayIndices, numbers);
+
+        fixed (byte* bufferPtr = utf8Buffer)
+        fixed (int* offsetsPtr = offsets)
+        fixed (uint* comparisonIndicesPtr = comparisonIndices)
+        fixed (uint* displayIndicesPtr = displayIndices)
+        fixed (int* numbersPtr = numbers)
+        {
+            PokeSharpNameExporter.CallGetOrAddEntriesUtf8(
+                (IntPtr)bufferPtr,
+                offsetsPtr,
+                count,
+                findType == FindName.Find ? NativeBool.True : NativeBool.False,
+                comparisonIndicesPtr,
+                displayIndicesPtr,
+                numbersPtr
+            );
+        }
+    }
+
     public bool IsValid(uint comparisonIndex, uint displayIndex)
     {
         return PokeSharpNameExporter.CallIsValid(comparisonIndex, displayIndex).ToManagedBool();
@@ -33,6 +112,9 @@ internal unsafe class UnrealNameProvider : INameProvider
 
     public bool Equals(uint comparisonIndex, uint displayIndex, int number, ReadOnlySpan<char> span)
     {
+        if (_displayTable.TryGetDisplayString(displayIndex, out var displayString))
+            return MatchesName(comparisonIndex, displayString, number, span);
+
         fixed (char* spanPtr = span)
         {
             return PokeSharpNameExporter
@@ -43,16 +125,124 @@ internal unsafe class UnrealNameProvider : INameProvider
 
     public string GetString(uint comparisonIndex, uint displayStringId, int number)
     {
-        var result = new UnmanagedArray();
-        var strPointer = (IntPtr)(&result);
-        try
+        Span<char> buffer = stackalloc char[MaxDisplayLength];
+        TryFormat(comparisonIndex, displayStringId, number, buffer, out var charsWritten);
+        return new string(buffer[..charsWritten]);
+    }
+
+    public bool TryFormat(
+        uint comparisonIndex,
+        uint displayStringId,
+        int number,
+        Span<char> destination,
+        out int charsWritten
+    )
+    {
+        return _displayTable.TryGetDisplayString(displayStringId, out var displayString)
+            ? FormatName(displayString, number, destination, out charsWritten)
+            : TryFormatFromEntry(comparisonIndex, displayStringId, number, destination, out charsWritten);
+    }
+
+    private static bool TryFormatFromEntry(
+        uint comparisonIndex,
+        uint displayStringId,
+        int number,
+        Span<char> destination,
+        out int charsWritten
+    )
+    {
+        // Copy the characters stored in the name entry onto the stack rather than building an FString from them. This
+        // also publishes the entry to the display table, so the next lookup will not need to come back here.
+        Span<char> entry = stackalloc char[NameSize];
+        int length;
+        NativeBool isWide;
+        fixed (char* entryPtr = entry)
+        {
+            length = PokeSharpNameExporter.CallGetPlainName(
+                comparisonIndex,
+                displayStringId,
+                (IntPtr)entryPtr,
+                out isWide
+            );
+        }
+
+        if (!isWide.ToManagedBool())
         {
-            PokeSharpNameExporter.CallGetString(comparisonIndex, displayStringId, number, ref result);
-            return StringMarshaller.FromNative(strPointer, 0);
+            // Widen in place from the back, since every character only ever moves further into the buffer
+            var bytes = MemoryMarshal.AsBytes(entry);
+            for (var i = length - 1; i >= 0; i--)
+            {
+                entry[i] = (char)bytes[i];
+            }
         }
-        finally
+
+        return FormatName(entry[..length], number, destination, out charsWritten);
+    }
+
+    private static bool FormatName(
+        ReadOnlySpan<char> displayString,
+        int number,
+        Span<char> destination,
+        out int charsWritten
+    )
+    {
+        charsWritten = 0;
+        if (!displayString.TryCopyTo(destination))
+            return false;
+
+        if (number == Name.NoNumber)
         {
-            StringMarshaller.DestructInstance(strPointer, 0);
+            charsWritten = displayString.Length;
+            return true;
         }
+
+        var suffix = destination[displayString.Length..];
+        if (suffix.IsEmpty)
+            return false;
+
+        if (!(number - 1).TryFormat(suffix[1..], out var digits, provider: CultureInfo.InvariantCulture))
+            return false;
+
+        suffix[0] = '_';
+        charsWritten = displayString.Length + 1 + digits;
+        return true;
+    }
+
+    private static bool MatchesName(
+        uint comparisonIndex,
+        ReadOnlySpan<char> displayString,
+        int number,
+        ReadOnlySpan<char> span
+    )
+    {
+        // An empty string is treated the same as None, matching the native comparison
+        if (span.IsEmpty)
+            return comparisonIndex == 0 && number == Name.NoNumber;
+
+        if (number == Name.NoNumber)
+            return span.Equals(displayString, StringComparison.OrdinalIgnoreCase);
+
+        if (
+            span.Length <= displayString.Length
+            || span[displayString.Length] != '_'
+            || !span[..displayString.Length].Equals(displayString, StringComparison.OrdinalIgnoreCase)
+        )
+            return false;
+
+        Span<char> digits = stackalloc char[11];
+        (number - 1).TryFormat(digits, out var digitCount, provider: CultureInfo.InvariantCulture);
+        return span[(displayString.Length + 1)..].SequenceEqual(digits[..digitCount]);
+    }
+
+    private static void ValidateBatchOutputs(
+        int count,
+        Span<uint> comparisonIndices,
+        Span<uint> displayIndices,
+        Span<int> numbers
+    )
+    {
+        // The native side writes straight through the pointers, so undersized outputs must never reach it
+        if (comparisonIndices.Length < count || displayIndices.Length < count || numbers.Length < count)
+            throw new ArgumentException("Every output span must hold one entry per name in the batch.");
     }
 }
@@ -1,5 +1,6 @@
 ﻿using PokeSharp.Core.Strings;
 using PokeSharp.Unreal.Core.Interop;
+using PokeSharp.Unreal.Core.Utils;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Marshallers;
 
@@ -7,7 +8,10 @@ namespace PokeSharp.Unreal.Core.Strings;
 
 internal sealed unsafe class UnrealTextData : ITextData
 {
+    private static readonly uint* CultureGeneration = (uint*)PokeSharpTextExporter.CallGetCultureGeneration();
+
     private FTextData _textData;
+    private CachedDisplayString? _displayString;
 
     public string? SourceString
     {
@@ -22,8 +26,16 @@ internal sealed unsafe class UnrealTextData : ITextData
     {
         get
         {
-            var nativeString = PokeSharpTextExporter.CallGetSourceString(ref _textData);
-            return StringMarshaller.FromNative(nativeString, 0);
+            // The display string only changes along with the culture, so the managed copy is kept until it does
+            var generation = Volatile.Read(ref *CultureGeneration);
+            var cached = _displayString;
+            if (cached is not null && cached.Generation == generation)
+                return cached.Value;
+
+            var nativeString = PokeSharpTextExporter.CallGetDisplayString(ref _textData);
+            var displayString = StringMarshaller.FromNative(nativeString, 0);
+            _displayString = new CachedDisplayString(displayString, generation);
+            return displayString;
         }
     }
 
@@ -67,6 +79,11 @@ internal sealed unsafe class UnrealTextData : ITextData
         }
     }
 
+    /// <summary>
+    /// A bitwise copy of the native text, which does not hold a reference of its own.
+    /// </summary>
+    internal FTextData NativeData => _textData;
+
     public bool IsCultureInvariant => PokeSharpTextExporter.CallIsCultureInvariant(ref _textData).ToManagedBool();
     public bool IsTransient => PokeSharpTextExporter.CallIsTransient(ref _textData).ToManagedBool();
     public bool ShouldGatherForLocalization =>
@@ -133,6 +150,17 @@ internal sealed unsafe class UnrealTextData : ITextData
         return new ReadOnlySpan<char>((char*)buffer, length);
     }
 
+    /// <summary>
+    /// Gets the characters of the display string without copying them, keeping them valid until the returned pin is
+    /// disposed. Unlike <see cref="AsDisplaySpan"/>, the span survives a culture change.
+    /// </summary>
+    public PinnedDisplayString PinDisplayString()
+    {
+        var pin = new SharedPtr();
+        PokeSharpTextExporter.CallPinDisplayString(ref _textData, ref pin, out var buffer, out var length);
+        return new PinnedDisplayString(new ReadOnlySpan<char>((char*)buffer, length), pin);
+    }
+
     public string ToLocString()
     {
         PokeSharpTextExporter.CallToLocText(ref _textData, out var buffer);
@@ -146,6 +174,8 @@ internal sealed unsafe class UnrealTextData : ITextData
             StringMarshaller.DestructInstance((IntPtr)bufferPtr, 0);
         }
     }
+
+    private sealed record CachedDisplayString(string Value, uint Generation);
 }
 
 public static class UnrealTextDataExtensions
@@ -160,4 +190,58 @@ public static class UnrealTextDataExtensions
             return new UnrealTextData(textData);
         }
     }
+
+    extension(Text)
+    {
+        /// <summary>
+        /// Creates a <see cref="Text"/> that refers to an entry of an Unreal string table.
+        /// </summary>
+        /// <param name="tableId">The id of the string table.</param>
+        /// <param name="key">The key of the entry within the table.</param>
+        /// <returns>The text of the entry.</returns>
+        public static unsafe Text FromStringTable(FName tableId, ReadOnlySpan<char> key)
+        {
+            fixed (char* keyPtr = key)
+            {
+                PokeSharpTextExporter.CallFromStringTable(tableId, (IntPtr)keyPtr, key.Length, out var textData);
+                return new Text(new UnrealTextData(textData));
+            }
+        }
+
+        /// <summary>
+        /// Resolves every entry of a registered string table in one call, so that later calls to
+        /// <see cref="FromStringTable"/> for that table only copy a cached reference.
+        /// </summary>
+        /// <param name="tableId">The id of the string table.</param>
+        /// <returns>The number of entries in the table, or 0 if no such table is registered.</returns>
+        public static int PreloadStringTable(FName tableId)
+        {
+            return PokeSharpTextExporter.CallPreloadStringTable(tableId);
+        }
+
+        /// <summary>
+        /// Pins the display strings of a batch of texts, such as every line of a menu, in a single native call.
+        /// </summary>
+        /// <param name="texts">The texts to pin.</param>
+        /// <returns>The pinned display strings, which must be disposed once they are no longer needed.</returns>
+        public static PinnedDisplayStrings PinDisplayStrings(ReadOnlySpan<Text> texts)
+        {
+            return PinnedDisplayStrings.Pin(texts);
+        }
+    }
+
+    extension(Text text)
+    {
+        /// <summary>
+        /// Gets the characters of the display string without copying them, keeping them valid until the returned pin
+        /// is disposed, even if the culture changes in the meantime.
+        /// </summary>
+        /// <returns>The pinned display string, which must be disposed once it is no longer needed.</returns>
+        public PinnedDisplayString PinDisplayString()
+        {
+            return text.Data is UnrealTextData unrealText
+                ? unrealText.PinDisplayString()
+                : new PinnedDisplayString(text.AsReadOnlySpan());
+        }
+    }
 }
@@ -1,8 +1,11 @@
-﻿using PokeSharp.Core.Strings;
+﻿using System.Buffers;
+using PokeSharp.Core.Strings;
+using PokeSharp.Unreal.Core.Interop;
+using UnrealSharp.Core;
 
 namespace PokeSharp.Unreal.Core.Strings;
 
-internal class UnrealTextProvider : ITextProvider
+internal unsafe class UnrealTextProvider : ITextProvider
 {
     public ITextData FromSimpleString(string text)
     {
@@ -24,6 +27,63 @@ internal class UnrealTextProvider : ITextProvider
         return new UnrealTextData(ns, key, value);
     }
 
+    public void FromLocalized(
+        ReadOnlySpan<char> ns,
+        ReadOnlySpan<string> keys,
+        ReadOnlySpan<string> values,
+        Span<ITextData> results
+    )
+    {
+        var count = keys.Length;
+        if (count == 0)
+            return;
+
+        ArgumentOutOfRangeException.ThrowIfNotEqual(values.Length, count, nameof(values));
+        ArgumentOutOfRangeException.ThrowIfLessThan(results.Length, count, nameof(results));
+
+        var keyOffsets = ArrayPool<int>.Shared.Rent(count + 1);
+        var valueOffsets = ArrayPool<int>.Shared.Rent(count + 1);
+        var keyBuffer = PackStrings(keys, keyOffsets);
+        var valueBuffer = PackStrings(values, valueOffsets);
+        var texts = ArrayPool<FTextData>.Shared.Rent(count);
+        try
+        {
+            fixed (char* nsPtr = ns)
+            fixed (char* keyBufferPtr = keyBuffer)
+            fixed (int* keyOffsetsPtr = keyOffsets)
+            fixed (char* valueBufferPtr = valueBuffer)
+            fixed (int* valueOffsetsPtr = valueOffsets)
+            fixed (FTextData* textsPtr = texts)
+            {
+                PokeSharpTextExporter.CallFromLocalizedBatch(
+                    (IntPtr)nsPtr,
+                    ns.Length,
+                    (IntPtr)keyBufferPtr,
+                    keyOffsetsPtr,
+                    (IntPtr)valueBufferPtr,
+                    valueOffsetsPtr,
+                    count,
+                    null,
+                    textsPtr
+                );
+            }
+
+            // Each text data takes over the reference written into the rented array
+            for (var i = 0; i < count; i++)
+            {
+                results[i] = new UnrealTextData(texts[i]);
+            }
+        }
+        finally
+        {
+            ArrayPool<FTextData>.Shared.Return(texts, clearArray: true);
+            ArrayPool<char>.Shared.Return(valueBuffer);
+            ArrayPool<char>.Shared.Return(keyBuffer);
+            ArrayPool<int>.Shared.Return(valueOffsets);
+            ArrayPool<int>.Shared.Return(keyOffsets);
+        }
+    }
+
     public ITextData FromLocText(string locString)
     {
         return FromLocText(locString.AsSpan());
@@ -33,4 +93,25 @@ internal class UnrealTextProvider : ITextProvider
     {
         return UnrealTextData.FromLocText(locString);
     }
+
+    private static char[] PackStrings(ReadOnlySpan<string> values, int[] offsets)
+    {
+        var length = 0;
+        foreach (var value in values)
+        {
+            length += value.Length;
+        }
+
+        var buffer = ArrayPool<char>.Shared.Rent(Math.Max(length, 1));
+        var position = 0;
+        for (var i = 0; i < values.Length; i++)
+        {
+            offsets[i] = position;
+            values[i].CopyTo(buffer.AsSpan(position));
+            position += values[i].Length;
+        }
+
+        offsets[values.Length] = position;
+        return buffer;
+    }
 }
@@ -10,6 +10,6 @@ public static class DeveloperSettingsRegistration
     [RegisterServices]
     public static void RegisterServices(IServiceCollection services)
     {
-        services.AddUnrealOptions<UPokeSharpSettings, GameSettings>();
+        services.AddUnrealSnapshotOptions<UPokeSharpSettings, GameSettings>();
     }
 }
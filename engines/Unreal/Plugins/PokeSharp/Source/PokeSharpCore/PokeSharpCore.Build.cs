@@ -21,7 +21,7 @@ public class PokeSharpCore : ModuleRules
         );
 
         PrivateDependencyModuleNames.AddRange(
-            ["CoreUObject", "Engine", "Slate", "SlateCore", "UMG", "CommonUtilities", "GameplayTags"]
+            ["CoreUObject", "Engine", "Slate", "SlateCore", "UMG", "CommonUtilities", "GameplayTags", "Json"]
         );
     }
 }
@@ -0,0 +1,258 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Configuration/PokeSharpSettingsSnapshot.h"
+#include "Serialization/MessagePackWriter.h"
+#include "UObject/PropertyOptional.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    bool IsSnapshotProperty(const FProperty &Property)
+    {
+        return Property.HasAnyPropertyFlags(CPF_Config);
+    }
+
+    /**
+     * Unreal can't nest containers, so a struct holding nothing but a container stands in for the container itself.
+     */
+    const FProperty *GetWrappedContainer(const UStruct &Struct)
+    {
+        TFieldIterator<FProperty> It(&Struct);
+        if (!It)
+        {
+            return nullptr;
+        }
+
+        const auto *Property = *It;
+        if (++It)
+        {
+            return nullptr;
+        }
+
+        return Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>()
+                   ? Property
+                   : nullptr;
+    }
+
+    uint32 HashProperty(const FProperty &Property, uint32 Hash);
+
+    uint32 HashStruct(const UStruct &Struct, uint32 Hash)
+    {
+        for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+        {
+            Hash = HashProperty(**It, Hash);
+        }
+
+        return Hash;
+    }
+
+    uint32 HashProperty(const FProperty &Property, uint32 Hash)
+    {
+        Hash = FCrc::StrCrc32(*Property.GetName(), Hash);
+        Hash = FCrc::StrCrc32(*Property.GetCPPType(), Hash);
+        Hash = FCrc::TypeCrc32(Property.ArrayDim, Hash);
+
+        if (const auto *StructProperty = CastField<FStructProperty>(&Property))
+        {
+            return HashStruct(*StructProperty->Struct, Hash);
+        }
+
+        if (const auto *ArrayProperty = CastField<FArrayProperty>(&Property))
+        {
+            return HashProperty(*ArrayProperty->Inner, Hash);
+        }
+
+        if (const auto *SetProperty = CastField<FSetProperty>(&Property))
+        {
+            return HashProperty(*SetProperty->ElementProp, Hash);
+        }
+
+        if (const auto *MapProperty = CastField<FMapProperty>(&Property))
+        {
+            return HashProperty(*MapProperty->ValueProp, HashProperty(*MapProperty->KeyProp, Hash));
+        }
+
+        if (const auto *OptionalProperty = CastField<FOptionalProperty>(&Property))
+        {
+            return HashProperty(*OptionalProperty->GetValueProperty(), Hash);
+        }
+
+        return Hash;
+    }
+
+    void WriteValue(FMessagePackWriter &Writer, const FProperty &Property, const void *Value);
+
+    void WriteStruct(FMessagePackWriter &Writer, const UStruct &Struct, const void *Data)
+    {
+        if (const auto *Wrapped = GetWrappedContainer(Struct))
+        {
+            WriteValue(Writer, *Wrapped, Wrapped->ContainerPtrToValuePtr<void>(Data));
+            return;
+        }
+
+        uint32 Count = 0;
+        for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+        {
+            Count++;
+        }
+
+        Writer.WriteMapHeader(Count);
+        for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+        {
+            Writer.WriteString(It->GetName());
+            WriteValue(Writer, **It, It->ContainerPtrToValuePtr<void>(Data));
+        }
+    }
+
+    void WriteSingleValue(FMessagePackWriter &Writer, const FProperty &Property, const void *Value)
+    {
+        if (const auto *BoolProperty = CastField<FBoolProperty>(&Property))
+        {
+            Writer.WriteBool(BoolProperty->GetPropertyValue(Value));
+        }
+        else if (const auto *EnumProperty = CastField<FEnumProperty>(&Property))
+        {
+            Writer.WriteInt(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value));
+        }
+        else if (const auto *FloatProperty = CastField<FFloatProperty>(&Property))
+        {
+            Writer.WriteFloat(FloatProperty->GetPropertyValue(Value));
+        }
+        else if (const auto *DoubleProperty = CastField<FDoubleProperty>(&Property))
+        {
+            Writer.WriteDouble(DoubleProperty->GetPropertyValue(Value));
+        }
+        else if (const auto *UInt64Property = CastField<FUInt64Property>(&Property))
+        {
+            Writer.WriteUInt(UInt64Property->GetPropertyValue(Value));
+        }
+        else if (const auto *NumericProperty = CastField<FNumericProperty>(&Property))
+        {
+            Writer.WriteInt(NumericProperty->GetSignedIntPropertyValue(Value));
+        }
+        else if (const auto *StrProperty = CastField<FStrProperty>(&Property))
+        {
+            Writer.WriteString(*StrProperty->GetPropertyValuePtr(Value));
+        }
+        else if (const auto *NameProperty = CastField<FNameProperty>(&Property))
+        {
+            const FNameBuilder Name(NameProperty->GetPropertyValue(Value));
+            Writer.WriteString(Name.ToView());
+        }
+        else if (const auto *TextProperty = CastField<FTextProperty>(&Property))
+        {
+            // Managed code reads texts back from their loc-text form, so they keep their namespace and key
+            FString LocText;
+            FTextStringHelper::WriteToBuffer(LocText, TextProperty->GetPropertyValue(Value));
+            Writer.WriteString(LocText);
+        }
+        else if (const auto *StructProperty = CastField<FStructProperty>(&Property))
+        {
+            WriteStruct(Writer, *StructProperty->Struct, Value);
+        }
+        else if (const auto *ArrayProperty = CastField<FArrayProperty>(&Property))
+        {
+            FScriptArrayHelper Array(ArrayProperty, Value);
+            Writer.WriteArrayHeader(Array.Num());
+            for (int32 i = 0; i < Array.Num(); i++)
+            {
+                WriteValue(Writer, *ArrayProperty->Inner, Array.GetRawPtr(i));
+            }
+        }
+        else if (const auto *SetProperty = CastField<FSetProperty>(&Property))
+        {
+            FScriptSetHelper Set(SetProperty, Value);
+            Writer.WriteArrayHeader(Set.Num());
+            for (FScriptSetHelper::FIterator It(Set); It; ++It)
+            {
+                WriteValue(Writer, *SetProperty->ElementProp, Set.GetElementPtr(It));
+            }
+        }
+        else if (const auto *MapProperty = CastField<FMapProperty>(&Property))
+        {
+            FScriptMapHelper Map(MapProperty, Value);
+            Writer.WriteMapHeader(Map.Num());
+            for (FScriptMapHelper::FIterator It(Map); It; ++It)
+            {
+                WriteValue(Writer, *MapProperty->KeyProp, Map.GetKeyPtr(It));
+                WriteValue(Writer, *MapProperty->ValueProp, Map.GetValuePtr(It));
+            }
+        }
+        else if (const auto *OptionalProperty = CastField<FOptionalProperty>(&Property))
+        {
+            if (OptionalProperty->IsSet(Value))
+            {
+                WriteValue(Writer,
+                           *OptionalProperty->GetValueProperty(),
+                           OptionalProperty->GetValuePointerForRead(Value));
+            }
+            else
+            {
+                Writer.WriteNil();
+            }
+        }
+        else
+        {
+            // Anything else, such as object references, is written in the same text form the config file uses
+            FString Text;
+            Property.ExportText_Direct(Text, Value, Value, nullptr, PPF_None);
+            Writer.WriteString(Text);
+        }
+    }
+
+    void WriteValue(FMessagePackWriter &Writer, const FProperty &Property, const void *Value)
+    {
+        if (Property.ArrayDim == 1)
+        {
+            WriteSingleValue(Writer, Property, Value);
+            return;
+        }
+
+        Writer.WriteArrayHeader(Property.ArrayDim);
+        for (int32 i = 0; i < Property.ArrayDim; i++)
+        {
+            WriteSingleValue(Writer, Property, static_cast<const uint8 *>(Value) + i * Property.GetElementSize());
+        }
+    }
+} // namespace
+
+uint32 FPokeSharpSettingsSnapshot::ComputeSchemaHash(const UClass &Class)
+{
+    uint32 Hash = 0;
+    for (TFieldIterator<FProperty> It(&Class); It; ++It)
+    {
+        if (IsSnapshotProperty(**It))
+        {
+            Hash = HashProperty(**It, Hash);
+        }
+    }
+
+    return Hash;
+}
+
+void FPokeSharpSettingsSnapshot::Write(const UObject &Settings, TArray<uint8> &OutBuffer)
+{
+    const auto &Class = *Settings.GetClass();
+    uint32 Count = 0;
+    for (TFieldIterator<FProperty> It(&Class); It; ++It)
+    {
+        if (IsSnapshotProperty(**It))
+        {
+            Count++;
+        }
+    }
+
+    OutBuffer.Reset();
+    FMessagePackWriter Writer(OutBuffer);
+    Writer.WriteArrayHeader(2);
+    Writer.WriteUInt(ComputeSchemaHash(Class));
+    Writer.WriteMapHeader(Count);
+    for (TFieldIterator<FProperty> It(&Class); It; ++It)
+    {
+        if (IsSnapshotProperty(**It))
+        {
+            Writer.WriteString(It->GetName());
+            WriteValue(Writer, **It, It->ContainerPtrToValuePtr<void>(&Settings));
+        }
+    }
+}
@@ -1,39 +1,19 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Configuration/SettingsChangeManager.h"
+#include "Async/Async.h"
 #include "Containers/Ticker.h"
 #include "Engine/DeveloperSettings.h"
 #include "LogPokeSharpCore.h"
+#include "Misc/CoreDelegates.h"
 #include "UObject/Package.h"
 
-TObjectPtr<USettingsChangeManager> USettingsChangeManager::Instance;
-
-void FDebouncedSettingsCallback::RequestExecution(const float DebounceSeconds)
-{
-    // Already scheduled – just mark dirty, no new ticker
-    if (bPendingExecution)
-    {
-        return;
-    }
-
-    bPendingExecution = true;
-
-    // Schedule a one–shot ticker
-    TickerHandle =
-        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDebouncedSettingsCallback::OnTick),
-                                             DebounceSeconds);
-}
-
-bool FDebouncedSettingsCallback::OnTick(float)
+namespace
 {
-    // Clear pending state before invoking, in case callback triggers new changes
-    bPendingExecution = false;
-    TickerHandle.Reset();
+    constexpr float DebounceSeconds = 0.10f;
+} // namespace
 
-    Callback->Invoke();
-    // Returning false so this ticker is not called again
-    return false;
-}
+TObjectPtr<USettingsChangeManager> USettingsChangeManager::Instance;
 
 void USettingsChangeManager::Initialize()
 {
@@ -41,6 +21,11 @@ void USettingsChangeManager::Initialize()
         NewObject<USettingsChangeManager>(GetTransientPackage(),
                                           TEXT("SettingsChangeManager"),
                                           RF_Public | RF_MarkAsRootSet);
+
+    // Runtime config reloads, such as hotfixes, never go through the editor's change events
+    Instance->ConfigSectionsChangedHandle = FCoreDelegates::TSOnConfigSectionsChanged().AddUObject(
+        Instance.Get(),
+        &USettingsChangeManager::OnConfigSectionsChanged);
 }
 
 void USettingsChangeManager::Shutdown()
@@ -51,27 +36,41 @@ void USettingsChangeManager::Shutdown()
         return;
     }
 
-    Instance->Callbacks.Empty();
+    FCoreDelegates::TSOnConfigSectionsChanged().Remove(Instance->ConfigSectionsChangedHandle);
+    if (Instance->TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Instance->TickerHandle);
+    }
+
+#if WITH_EDITOR
+    for (const auto &WeakSettings : Instance->BoundSettings)
+    {
+        if (auto *Settings = WeakSettings.Get(); Settings != nullptr)
+        {
+            Settings->OnSettingChanged().RemoveAll(Instance.Get());
+        }
+    }
+#endif
+
+    Instance->Bindings.Empty();
+    Instance->BoundSettings.Empty();
+    Instance->DirtyProperties.Empty();
     Instance = nullptr;
 }
 
 FGuid USettingsChangeManager::Bind(UDeveloperSettings *Settings, const FGCHandle &ManagedDelegate) noexcept
 {
     auto Guid = FGuid::NewGuid();
-    auto Callback = MakeShared<FSettingsChangeDelegateCallback>(ManagedDelegate);
-
-    constexpr float DebounceSeconds = 0.10f;
-    const auto &DebouncedEntry = Callbacks.Emplace(Guid, MakeShared<FDebouncedSettingsCallback>(Callback));
+    Bindings.Emplace(Guid, FBinding{Settings, MakeShared<FSettingsChangeDelegateCallback>(ManagedDelegate)});
 
+    // Every binding to the same settings object shares one subscription to its change event
+    bool bAlreadyBound = false;
+    BoundSettings.Add(Settings, &bAlreadyBound);
 #if WITH_EDITOR
-    Settings->OnSettingChanged().AddLambda(
-        [WeakBinding = DebouncedEntry.ToWeakPtr()](UObject *, FPropertyChangedEvent &)
-        {
-            const auto Binding = WeakBinding.Pin();
-            if (Binding == nullptr)
-                return;
-            Binding->RequestExecution(DebounceSeconds);
-        });
+    if (!bAlreadyBound)
+    {
+        Settings->OnSettingChanged().AddUObject(this, &USettingsChangeManager::OnSettingChanged);
+    }
 #endif
 
     return Guid;
@@ -79,5 +78,126 @@ FGuid USettingsChangeManager::Bind(UDeveloperSettings *Settings, const FGCHandle
 
 void USettingsChangeManager::Unbind(const FGuid &Guid) noexcept
 {
-    Callbacks.Remove(Guid);
-}
\ No newline at end of file
+    const auto *Binding = Bindings.Find(Guid);
+    if (Binding == nullptr)
+    {
+        return;
+    }
+
+    const auto WeakSettings = Binding->Settings;
+    Bindings.Remove(Guid);
+    for (const auto &[OtherGuid, Other] : Bindings)
+    {
+        if (Other.Settings == WeakSettings)
+        {
+            return;
+        }
+    }
+
+    // That was the last binding to the settings object, so nobody is left to hear about its changes
+    BoundSettings.Remove(WeakSettings);
+    DirtyProperties.Remove(WeakSettings);
+#if WITH_EDITOR
+    if (auto *Settings = WeakSettings.Get(); Settings != nullptr)
+    {
+        Settings->OnSettingChanged().RemoveAll(this);
+    }
+#endif
+}
+
+void USettingsChangeManager::MarkDirty(UDeveloperSettings &Settings, const FName PropertyName)
+{
+    check(IsInGameThread());
+
+    auto &Properties = DirtyProperties.FindOrAdd(&Settings);
+    if (PropertyName.IsNone())
+    {
+        for (TFieldIterator<FProperty> It(Settings.GetClass()); It; ++It)
+        {
+            if (It->HasAnyPropertyFlags(CPF_Config))
+            {
+                Properties.Add(It->GetFName());
+            }
+        }
+    }
+    else
+    {
+        Properties.Add(PropertyName);
+    }
+
+    // Changes keep piling up until the pending dispatch runs, so there is never more than one ticker
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &USettingsChangeManager::Dispatch),
+            DebounceSeconds);
+    }
+}
+
+#if WITH_EDITOR
+void USettingsChangeManager::OnSettingChanged(UObject *Settings, FPropertyChangedEvent &PropertyChangedEvent)
+{
+    MarkDirty(*CastChecked<UDeveloperSettings>(Settings), PropertyChangedEvent.GetMemberPropertyName());
+}
+#endif
+
+void USettingsChangeManager::OnConfigSectionsChanged(const FString &IniFilename, const TSet<FString> &SectionNames)
+{
+    if (!IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::GameThread,
+                  [WeakThis = TWeakObjectPtr<USettingsChangeManager>(this), IniFilename, SectionNames]
+                  {
+                      if (auto *This = WeakThis.Get(); This != nullptr)
+                      {
+                          This->OnConfigSectionsChanged(IniFilename, SectionNames);
+                      }
+                  });
+        return;
+    }
+
+    for (const auto &WeakSettings : BoundSettings)
+    {
+        // Class config lives in a section named after the path of the class
+        if (auto *Settings = WeakSettings.Get();
+            Settings != nullptr && SectionNames.Contains(Settings->GetClass()->GetPathName()))
+        {
+            MarkDirty(*Settings, NAME_None);
+        }
+    }
+}
+
+bool USettingsChangeManager::Dispatch(float)
+{
+    TickerHandle.Reset();
+
+    // Callbacks may cause further changes, which go into the next batch
+    auto Changes = MoveTemp(DirtyProperties);
+    DirtyProperties.Reset();
+
+    // Callbacks may also bind or unbind, so work from a copy of the bindings that are affected
+    TArray<TPair<FGuid, FBinding>> Affected;
+    for (const auto &[Guid, Binding] : Bindings)
+    {
+        if (Changes.Contains(Binding.Settings))
+        {
+            Affected.Emplace(Guid, Binding);
+        }
+    }
+
+    for (const auto &[Guid, Binding] : Affected)
+    {
+        if (!Bindings.Contains(Guid))
+        {
+            continue;
+        }
+
+        DispatchingProperties = Changes[Binding.Settings].Array();
+        Binding.Callback->Invoke();
+    }
+
+    DispatchingProperties.Reset();
+
+    // Returning false so this ticker is not called again
+    return false;
+}
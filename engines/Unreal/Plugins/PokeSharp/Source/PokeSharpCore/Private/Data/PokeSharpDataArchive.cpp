@@ -0,0 +1,281 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Data/PokeSharpDataArchive.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "LogPokeSharpCore.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+    /**
+     * A read-only handle over a window of the archive's shared file handle.
+     */
+    class FDataArchiveEntryHandle final : public IFileHandle
+    {
+      public:
+        FDataArchiveEntryHandle(TSharedRef<FPokeSharpDataArchive> &&InArchive, const int64 InOffset, const int64 InSize)
+            : Archive(MoveTemp(InArchive)), Offset(InOffset), EntrySize(InSize)
+        {
+        }
+
+        int64 Tell() override
+        {
+            return Position;
+        }
+
+        bool Seek(const int64 NewPosition) override
+        {
+            if (NewPosition < 0 || NewPosition > EntrySize)
+            {
+                return false;
+            }
+
+            Position = NewPosition;
+            return true;
+        }
+
+        bool SeekFromEnd(const int64 NewPositionRelativeToEnd) override
+        {
+            return Seek(EntrySize + NewPositionRelativeToEnd);
+        }
+
+        bool Read(uint8 *Destination, const int64 BytesToRead) override
+        {
+            if (BytesToRead > EntrySize - Position || !Archive->ReadAt(Offset + Position, Destination, BytesToRead))
+            {
+                return false;
+            }
+
+            Position += BytesToRead;
+            return true;
+        }
+
+        bool Write(const uint8 *, int64) override
+        {
+            return false;
+        }
+
+        bool Flush(bool) override
+        {
+            return true;
+        }
+
+        bool Truncate(int64) override
+        {
+            return false;
+        }
+
+        int64 Size() override
+        {
+            return EntrySize;
+        }
+
+      private:
+        TSharedRef<FPokeSharpDataArchive> Archive;
+        int64 Offset;
+        int64 EntrySize;
+        int64 Position = 0;
+    };
+
+    /**
+     * A read-only handle over an inflated copy of a compressed entry.
+     */
+    class FDataArchiveMemoryHandle final : public IFileHandle
+    {
+      public:
+        explicit FDataArchiveMemoryHandle(TArray64<uint8> &&InData) : Data(MoveTemp(InData))
+        {
+        }
+
+        int64 Tell() override
+        {
+            return Position;
+        }
+
+        bool Seek(const int64 NewPosition) override
+        {
+            if (NewPosition < 0 || NewPosition > Data.Num())
+            {
+                return false;
+            }
+
+            Position = NewPosition;
+            return true;
+        }
+
+        bool SeekFromEnd(const int64 NewPositionRelativeToEnd) override
+        {
+            return Seek(Data.Num() + NewPositionRelativeToEnd);
+        }
+
+        bool Read(uint8 *Destination, const int64 BytesToRead) override
+        {
+            if (BytesToRead > Data.Num() - Position)
+            {
+                return false;
+            }
+
+            FMemory::Memcpy(Destination, Data.GetData() + Position, BytesToRead);
+            Position += BytesToRead;
+            return true;
+        }
+
+        bool Write(const uint8 *, int64) override
+        {
+            return false;
+        }
+
+        bool Flush(bool) override
+        {
+            return true;
+        }
+
+        bool Truncate(int64) override
+        {
+            return false;
+        }
+
+        int64 Size() override
+        {
+            return Data.Num();
+        }
+
+      private:
+        TArray64<uint8> Data;
+        int64 Position = 0;
+    };
+} // namespace
+
+FPokeSharpDataArchive::FPokeSharpDataArchive(TUniquePtr<IFileHandle> &&InHandle) : Handle(MoveTemp(InHandle))
+{
+}
+
+FPokeSharpDataArchive::~FPokeSharpDataArchive() = default;
+
+TSharedPtr<FPokeSharpDataArchive> FPokeSharpDataArchive::Open(const FString &FileName)
+{
+    TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FileName));
+    if (Handle == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto Archive = MakeShared<FPokeSharpDataArchive>(MoveTemp(Handle));
+    if (!Archive->ReadTableOfContents())
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("%s is not a valid data archive"), *FileName);
+        return nullptr;
+    }
+
+    return Archive;
+}
+
+const FPokeSharpDataArchiveEntry *FPokeSharpDataArchive::FindEntry(const FStringView Name) const
+{
+    return Entries.FindByHash(GetTypeHash(Name), Name);
+}
+
+IFileHandle *FPokeSharpDataArchive::OpenEntry(const FStringView Name)
+{
+    const auto *Entry = FindEntry(Name);
+    if (Entry == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (Entry->Compression == EPokeSharpDataCompression::None)
+    {
+        return new FDataArchiveEntryHandle(AsShared(), Entry->Offset, Entry->Size);
+    }
+
+    TArray64<uint8> Compressed;
+    Compressed.SetNumUninitialized(Entry->Size);
+    if (!ReadAt(Entry->Offset, Compressed.GetData(), Entry->Size))
+    {
+        return nullptr;
+    }
+
+    if (FCrc::MemCrc32(Compressed.GetData(), static_cast<int32>(Compressed.Num())) != Entry->Crc)
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Data archive entry %.*s failed its checksum"), Name.Len(), Name.GetData());
+        return nullptr;
+    }
+
+    TArray64<uint8> Uncompressed;
+    Uncompressed.SetNumUninitialized(Entry->UncompressedSize);
+    if (!FCompression::UncompressMemory(NAME_Zlib,
+                                        Uncompressed.GetData(),
+                                        Uncompressed.Num(),
+                                        Compressed.GetData(),
+                                        Compressed.Num()))
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Failed to inflate data archive entry %.*s"), Name.Len(), Name.GetData());
+        return nullptr;
+    }
+
+    return new FDataArchiveMemoryHandle(MoveTemp(Uncompressed));
+}
+
+bool FPokeSharpDataArchive::ReadAt(const int64 Offset, uint8 *Destination, const int64 Size)
+{
+    FScopeLock Lock(&HandleLock);
+    return Handle->Seek(Offset) && Handle->Read(Destination, Size);
+}
+
+bool FPokeSharpDataArchive::ReadTableOfContents()
+{
+    TArray<uint8> Header;
+    Header.SetNumUninitialized(HeaderSize);
+    if (!ReadAt(0, Header.GetData(), HeaderSize))
+    {
+        return false;
+    }
+
+    uint32 FileMagic;
+    uint32 FileVersion;
+    uint32 EntryCount;
+    uint32 TocSize;
+    FMemoryReader HeaderReader(Header);
+    HeaderReader << FileMagic << FileVersion << EntryCount << TocSize;
+    if (FileMagic != Magic || FileVersion != Version)
+    {
+        return false;
+    }
+
+    TArray<uint8> Toc;
+    Toc.SetNumUninitialized(TocSize);
+    if (!ReadAt(HeaderSize, Toc.GetData(), TocSize))
+    {
+        return false;
+    }
+
+    FMemoryReader TocReader(Toc);
+    Entries.Reserve(EntryCount);
+    for (uint32 i = 0; i < EntryCount; i++)
+    {
+        uint16 NameLength;
+        TocReader << NameLength;
+
+        TArray<uint8, TInlineAllocator<64>> NameBuffer;
+        NameBuffer.SetNumUninitialized(NameLength);
+        TocReader.Serialize(NameBuffer.GetData(), NameLength);
+
+        FPokeSharpDataArchiveEntry Entry;
+        uint8 Compression;
+        TocReader << Compression << Entry.Offset << Entry.Size << Entry.UncompressedSize << Entry.Crc;
+        Entry.Compression = static_cast<EPokeSharpDataCompression>(Compression);
+        if (TocReader.IsError())
+        {
+            return false;
+        }
+
+        const FUTF8ToTCHAR Name(reinterpret_cast<const UTF8CHAR *>(NameBuffer.GetData()), NameLength);
+        Entries.Emplace(FString(Name.Length(), Name.Get()), Entry);
+    }
+
+    return true;
+}
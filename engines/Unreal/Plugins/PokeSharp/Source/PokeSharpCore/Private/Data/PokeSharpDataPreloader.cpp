@@ -0,0 +1,103 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Data/PokeSharpDataPreloader.h"
+#include "FileSystem/BlockCompressedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "LogPokeSharpCore.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FPokeSharpDataPreloader &FPokeSharpDataPreloader::Get()
+{
+    static FPokeSharpDataPreloader Instance;
+    return Instance;
+}
+
+void FPokeSharpDataPreloader::Start(const FString &Directory)
+{
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.pkdata")), true, false);
+
+    FScopeLock ScopeLock(&Lock);
+    for (const auto &FileName : FileNames)
+    {
+        auto FullPath = FPaths::Combine(Directory, FileName);
+        auto Key = GetFileKey(FullPath);
+        if (PendingFiles.Contains(Key))
+        {
+            continue;
+        }
+
+        PendingFiles.Emplace(MoveTemp(Key),
+                             UE::Tasks::Launch(UE_SOURCE_LOCATION, [Path = MoveTemp(FullPath)]() -> TUniquePtr<FBuffer> {
+                                 auto Buffer = MakeUnique<FBuffer>();
+                                 if (!FFileHelper::LoadFileToArray(*Buffer, *Path, FILEREAD_Silent))
+                                 {
+                                     UE_LOG(LogPokeSharpCore, Warning, TEXT("Failed to preload %s"), *Path);
+                                     return nullptr;
+                                 }
+
+                                 if (FBlockCompressedFileHandle::IsBlockCompressed(*Buffer))
+                                 {
+                                     auto Decompressed = MakeUnique<FBuffer>();
+                                     if (!FBlockCompressedFileHandle::Decompress(*Buffer, *Decompressed))
+                                     {
+                                         UE_LOG(LogPokeSharpCore, Warning, TEXT("Failed to decompress %s"), *Path);
+                                         return nullptr;
+                                     }
+
+                                     return Decompressed;
+                                 }
+
+                                 return Buffer;
+                             }));
+    }
+
+    UE_LOG(LogPokeSharpCore, Log, TEXT("Preloading %d data files from %s"), FileNames.Num(), *Directory);
+}
+
+TUniquePtr<FPokeSharpDataPreloader::FBuffer> FPokeSharpDataPreloader::Claim(const FStringView FilePath)
+{
+    const auto Key = GetFileKey(FilePath);
+    FReadTask Task;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (!PendingFiles.RemoveAndCopyValue(Key, Task))
+        {
+            return nullptr;
+        }
+    }
+
+    // Waiting happens outside the lock so that claims for other files are never blocked behind this read
+    return MoveTemp(Task.GetResult());
+}
+
+void FPokeSharpDataPreloader::Discard(const FStringView FilePath)
+{
+    const auto Key = GetFileKey(FilePath);
+
+    // The read is left to finish on its own and the buffer is released with the last reference to the task
+    FScopeLock ScopeLock(&Lock);
+    PendingFiles.Remove(Key);
+}
+
+FString FPokeSharpDataPreloader::GetFileKey(const FStringView FilePath)
+{
+    auto Key = FPaths::ConvertRelativePathToFull(FString(FilePath));
+    FPaths::NormalizeFilename(Key);
+    return Key;
+}
+
+void FPokeSharpDataPreloader::Reset()
+{
+    TMap<FString, FReadTask> Files;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Files = MoveTemp(PendingFiles);
+    }
+
+    for (auto &[FileName, Task] : Files)
+    {
+        Task.Wait();
+    }
+}
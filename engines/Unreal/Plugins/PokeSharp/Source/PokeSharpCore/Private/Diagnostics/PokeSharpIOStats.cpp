@@ -0,0 +1,181 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Diagnostics/PokeSharpIOStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Trace/Trace.inl"
+#include <atomic>
+
+DEFINE_STAT(STAT_PokeSharpIO_Read);
+DEFINE_STAT(STAT_PokeSharpIO_Write);
+DEFINE_STAT(STAT_PokeSharpIO_Seek);
+DEFINE_STAT(STAT_PokeSharpIO_BytesRead);
+DEFINE_STAT(STAT_PokeSharpIO_BytesWritten);
+
+UE_TRACE_CHANNEL_DEFINE(PokeSharpIOChannel);
+
+UE_TRACE_EVENT_BEGIN(PokeSharpIO, IOOperation)
+    UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+    UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+    UE_TRACE_EVENT_FIELD(uint64, Handle)
+    UE_TRACE_EVENT_FIELD(int64, Bytes)
+    UE_TRACE_EVENT_FIELD(uint8, Source)
+    UE_TRACE_EVENT_FIELD(uint8, Kind)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+    bool GTrackHandles = false;
+    FAutoConsoleVariableRef CVarTrackHandles(TEXT("PokeSharp.IO.TrackHandles"),
+                                             GTrackHandles,
+                                             TEXT("Keep I/O counters for each individual file handle and archive."));
+
+    struct FCounters
+    {
+        std::atomic<int64> ReadCalls = 0;
+        std::atomic<int64> BytesRead = 0;
+        std::atomic<int64> WriteCalls = 0;
+        std::atomic<int64> BytesWritten = 0;
+        std::atomic<int64> SeekCalls = 0;
+        std::atomic<int64> ReadLatency[FPokeSharpIOSnapshot::LatencyBucketCount] = {};
+        std::atomic<int64> WriteLatency[FPokeSharpIOSnapshot::LatencyBucketCount] = {};
+
+        void Record(const EPokeSharpIOOperation Operation, const int64 Bytes, const int32 Bucket)
+        {
+            // The counters are independent of each other, so there is nothing to order against
+            switch (Operation)
+            {
+            case EPokeSharpIOOperation::Read:
+                ReadCalls.fetch_add(1, std::memory_order_relaxed);
+                BytesRead.fetch_add(Bytes, std::memory_order_relaxed);
+                ReadLatency[Bucket].fetch_add(1, std::memory_order_relaxed);
+                break;
+            case EPokeSharpIOOperation::Write:
+                WriteCalls.fetch_add(1, std::memory_order_relaxed);
+                BytesWritten.fetch_add(Bytes, std::memory_order_relaxed);
+                WriteLatency[Bucket].fetch_add(1, std::memory_order_relaxed);
+                break;
+            case EPokeSharpIOOperation::Seek:
+                SeekCalls.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        void CopyTo(FPokeSharpIOSnapshot &OutSnapshot) const
+        {
+            OutSnapshot.ReadCalls = ReadCalls.load(std::memory_order_relaxed);
+            OutSnapshot.BytesRead = BytesRead.load(std::memory_order_relaxed);
+            OutSnapshot.WriteCalls = WriteCalls.load(std::memory_order_relaxed);
+            OutSnapshot.BytesWritten = BytesWritten.load(std::memory_order_relaxed);
+            OutSnapshot.SeekCalls = SeekCalls.load(std::memory_order_relaxed);
+            for (int32 i = 0; i < FPokeSharpIOSnapshot::LatencyBucketCount; i++)
+            {
+                OutSnapshot.ReadLatency[i] = ReadLatency[i].load(std::memory_order_relaxed);
+                OutSnapshot.WriteLatency[i] = WriteLatency[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        void Reset()
+        {
+            ReadCalls = 0;
+            BytesRead = 0;
+            WriteCalls = 0;
+            BytesWritten = 0;
+            SeekCalls = 0;
+            for (int32 i = 0; i < FPokeSharpIOSnapshot::LatencyBucketCount; i++)
+            {
+                ReadLatency[i] = 0;
+                WriteLatency[i] = 0;
+            }
+        }
+    };
+
+    FCounters GAggregateCounters[static_cast<int32>(EPokeSharpIOSource::Num)];
+
+    FCriticalSection GHandleCountersLock;
+    TMap<const void *, TUniquePtr<FCounters>> GHandleCounters;
+
+    int32 GetLatencyBucket(const uint64 StartCycles, const uint64 EndCycles)
+    {
+        const auto Microseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(EndCycles - StartCycles) * 1000000.0);
+        if (Microseconds == 0)
+        {
+            return 0;
+        }
+
+        return FMath::Min(static_cast<int32>(FMath::FloorLog2_64(Microseconds)) + 1,
+                          FPokeSharpIOSnapshot::LatencyBucketCount - 1);
+    }
+} // namespace
+
+void FPokeSharpIOStats::Record(const EPokeSharpIOSource Source,
+                               const EPokeSharpIOOperation Operation,
+                               const void *Handle,
+                               const int64 Bytes,
+                               const uint64 StartCycles,
+                               const uint64 EndCycles)
+{
+    const auto Bucket = GetLatencyBucket(StartCycles, EndCycles);
+    GAggregateCounters[static_cast<int32>(Source)].Record(Operation, Bytes, Bucket);
+
+    if (Operation == EPokeSharpIOOperation::Read)
+    {
+        INC_DWORD_STAT_BY(STAT_PokeSharpIO_BytesRead, Bytes);
+    }
+    else if (Operation == EPokeSharpIOOperation::Write)
+    {
+        INC_DWORD_STAT_BY(STAT_PokeSharpIO_BytesWritten, Bytes);
+    }
+
+    UE_TRACE_LOG(PokeSharpIO, IOOperation, PokeSharpIOChannel)
+        << IOOperation.StartCycle(StartCycles) << IOOperation.EndCycle(EndCycles)
+        << IOOperation.Handle(reinterpret_cast<UPTRINT>(Handle)) << IOOperation.Bytes(Bytes)
+        << IOOperation.Source(static_cast<uint8>(Source)) << IOOperation.Kind(static_cast<uint8>(Operation));
+
+    if (GTrackHandles && Handle != nullptr)
+    {
+        FScopeLock ScopeLock(&GHandleCountersLock);
+        auto &Counters = GHandleCounters.FindOrAdd(Handle);
+        if (Counters == nullptr)
+        {
+            Counters = MakeUnique<FCounters>();
+        }
+
+        Counters->Record(Operation, Bytes, Bucket);
+    }
+}
+
+void FPokeSharpIOStats::ForgetHandle(const void *Handle)
+{
+    FScopeLock ScopeLock(&GHandleCountersLock);
+    GHandleCounters.Remove(Handle);
+}
+
+void FPokeSharpIOStats::GetSnapshot(const EPokeSharpIOSource Source, FPokeSharpIOSnapshot &OutSnapshot)
+{
+    check(Source < EPokeSharpIOSource::Num);
+    GAggregateCounters[static_cast<int32>(Source)].CopyTo(OutSnapshot);
+}
+
+bool FPokeSharpIOStats::GetHandleSnapshot(const void *Handle, FPokeSharpIOSnapshot &OutSnapshot)
+{
+    FScopeLock ScopeLock(&GHandleCountersLock);
+    const auto *Counters = GHandleCounters.Find(Handle);
+    if (Counters == nullptr)
+    {
+        return false;
+    }
+
+    (*Counters)->CopyTo(OutSnapshot);
+    return true;
+}
+
+void FPokeSharpIOStats::Reset()
+{
+    for (auto &Counters : GAggregateCounters)
+    {
+        Counters.Reset();
+    }
+
+    FScopeLock ScopeLock(&GHandleCountersLock);
+    GHandleCounters.Empty();
+}
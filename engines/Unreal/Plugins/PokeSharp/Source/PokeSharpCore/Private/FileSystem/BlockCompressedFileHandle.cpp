@@ -0,0 +1,311 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "FileSystem/BlockCompressedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "LogPokeSharpCore.h"
+#include "Misc/Compression.h"
+#include <atomic>
+
+namespace
+{
+    FName GetCompressionFormat(const uint8 Compression)
+    {
+        switch (static_cast<EPokeSharpBlockCompression>(Compression))
+        {
+        case EPokeSharpBlockCompression::Zlib:
+            return NAME_Zlib;
+        case EPokeSharpBlockCompression::Gzip:
+            return NAME_Gzip;
+        case EPokeSharpBlockCompression::LZ4:
+            return NAME_LZ4;
+        case EPokeSharpBlockCompression::Oodle:
+            return NAME_Oodle;
+        default:
+            return NAME_None;
+        }
+    }
+
+    template <typename T>
+    T ReadValue(const uint8 *Source, const int32 Offset)
+    {
+        T Value;
+        FMemory::Memcpy(&Value, Source + Offset, sizeof(T));
+        return Value;
+    }
+} // namespace
+
+int64 FBlockCompressedFileHandle::FBlockIndex::GetUncompressedSize(const int32 Block) const
+{
+    return FMath::Min(BlockSize, UncompressedSize - Block * BlockSize);
+}
+
+bool FBlockCompressedFileHandle::FBlockIndex::DecompressBlock(const int32 Block,
+                                                              const uint8 *Source,
+                                                              uint8 *Destination) const
+{
+    const auto StoredSize = GetStoredSize(Block);
+    const auto BlockUncompressedSize = GetUncompressedSize(Block);
+    if (StoredSize == BlockUncompressedSize)
+    {
+        FMemory::Memcpy(Destination, Source, StoredSize);
+        return true;
+    }
+
+    return FCompression::UncompressMemory(Format, Destination, BlockUncompressedSize, Source, StoredSize);
+}
+
+bool FBlockCompressedFileHandle::IsBlockCompressed(IFileHandle &Handle)
+{
+    const auto Start = Handle.Tell();
+    uint32 FileMagic = 0;
+    const bool bRead = Handle.Seek(0) && Handle.Read(reinterpret_cast<uint8 *>(&FileMagic), sizeof(FileMagic));
+    Handle.Seek(Start);
+    return bRead && FileMagic == Magic;
+}
+
+bool FBlockCompressedFileHandle::IsBlockCompressed(const TConstArrayView64<uint8> Data)
+{
+    return Data.Num() >= HeaderSize && ReadValue<uint32>(Data.GetData(), 0) == Magic;
+}
+
+TUniquePtr<IFileHandle> FBlockCompressedFileHandle::Open(TUniquePtr<IFileHandle> &&Handle)
+{
+    uint8 Header[HeaderSize];
+    FBlockIndex Index;
+    if (!Handle->Seek(0) || !Handle->Read(Header, HeaderSize) || !ParseHeader(Header, Index))
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Block-compressed file has an invalid header"));
+        return nullptr;
+    }
+
+    auto *Offsets = reinterpret_cast<uint8 *>(Index.Offsets.GetData());
+    if (!Handle->Read(Offsets, static_cast<int64>(Index.Offsets.NumBytes())) ||
+        !ValidateOffsets(Index, Handle->Size()))
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Block-compressed file has an invalid block index"));
+        return nullptr;
+    }
+
+    return TUniquePtr<IFileHandle>(new FBlockCompressedFileHandle(MoveTemp(Handle), MoveTemp(Index)));
+}
+
+bool FBlockCompressedFileHandle::Decompress(const TConstArrayView64<uint8> Data, TArray64<uint8> &OutData)
+{
+    FBlockIndex Index;
+    if (!IsBlockCompressed(Data) || !ParseHeader(Data.GetData(), Index) ||
+        Data.Num() < HeaderSize + static_cast<int64>(Index.Offsets.NumBytes()))
+    {
+        return false;
+    }
+
+    FMemory::Memcpy(Index.Offsets.GetData(), Data.GetData() + HeaderSize, Index.Offsets.NumBytes());
+    if (!ValidateOffsets(Index, Data.Num()))
+    {
+        return false;
+    }
+
+    OutData.SetNumUninitialized(Index.UncompressedSize);
+    std::atomic bSucceeded = true;
+    ParallelFor(Index.Num(), [&](const int32 Block) {
+        if (!Index.DecompressBlock(Block,
+                                   Data.GetData() + Index.Offsets[Block],
+                                   OutData.GetData() + Block * Index.BlockSize))
+        {
+            bSucceeded = false;
+        }
+    });
+
+    return bSucceeded;
+}
+
+FBlockCompressedFileHandle::FBlockCompressedFileHandle(TUniquePtr<IFileHandle> &&InHandle, FBlockIndex &&InIndex)
+    : Handle(MoveTemp(InHandle)), Index(MoveTemp(InIndex))
+{
+}
+
+bool FBlockCompressedFileHandle::ParseHeader(const uint8 *Header, FBlockIndex &OutIndex)
+{
+    if (ReadValue<uint32>(Header, 0) != Magic || ReadValue<uint32>(Header, 4) != Version)
+    {
+        return false;
+    }
+
+    OutIndex.BlockSize = ReadValue<uint32>(Header, 8);
+    const auto BlockCount = ReadValue<uint32>(Header, 12);
+    OutIndex.UncompressedSize = ReadValue<int64>(Header, 16);
+    OutIndex.Format = GetCompressionFormat(Header[24]);
+    if (OutIndex.Format.IsNone() || OutIndex.BlockSize <= 0 || OutIndex.UncompressedSize < 0 ||
+        BlockCount != FMath::DivideAndRoundUp(OutIndex.UncompressedSize, OutIndex.BlockSize))
+    {
+        return false;
+    }
+
+    OutIndex.Offsets.SetNumUninitialized(static_cast<int32>(BlockCount) + 1);
+    return true;
+}
+
+bool FBlockCompressedFileHandle::ValidateOffsets(const FBlockIndex &Index, const int64 FileSize)
+{
+    const int64 DataStart = HeaderSize + static_cast<int64>(Index.Offsets.NumBytes());
+    if (Index.Offsets[0] < DataStart || Index.Offsets.Last() > FileSize)
+    {
+        return false;
+    }
+
+    for (int32 Block = 0; Block < Index.Num(); Block++)
+    {
+        const auto StoredSize = Index.GetStoredSize(Block);
+        // Blocks that don't compress are stored as-is, so a block is never larger than its uncompressed size
+        if (StoredSize <= 0 || StoredSize > Index.GetUncompressedSize(Block))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int64 FBlockCompressedFileHandle::Tell()
+{
+    return Position;
+}
+
+bool FBlockCompressedFileHandle::Seek(const int64 NewPosition)
+{
+    if (NewPosition < 0 || NewPosition > Index.UncompressedSize)
+    {
+        return false;
+    }
+
+    // Nothing is decompressed until the next read, so seeking is free
+    Position = NewPosition;
+    return true;
+}
+
+bool FBlockCompressedFileHandle::SeekFromEnd(const int64 NewPositionRelativeToEnd)
+{
+    return NewPositionRelativeToEnd <= 0 && Seek(Index.UncompressedSize + NewPositionRelativeToEnd);
+}
+
+bool FBlockCompressedFileHandle::Read(uint8 *Destination, const int64 BytesToRead)
+{
+    if (BytesToRead < 0 || Position + BytesToRead > Index.UncompressedSize)
+    {
+        return false;
+    }
+
+    if (BytesToRead == 0)
+    {
+        return true;
+    }
+
+    const int64 ReadStart = Position;
+    const int64 ReadEnd = Position + BytesToRead;
+    const auto First = static_cast<int32>(ReadStart / Index.BlockSize);
+    const auto Last = static_cast<int32>((ReadEnd - 1) / Index.BlockSize);
+
+    // Small sequential reads from a serializer usually land in the block that was decompressed last
+    if (First == Last && First == CachedBlockIndex)
+    {
+        FMemory::Memcpy(Destination, CachedBlock.GetData() + (ReadStart - First * Index.BlockSize), BytesToRead);
+        Position = ReadEnd;
+        return true;
+    }
+
+    // The blocks are stored back to back, so the compressed bytes for the whole range come from a single read
+    const auto CompressedStart = Index.Offsets[First];
+    const auto CompressedSize = Index.Offsets[Last + 1] - CompressedStart;
+    CompressedScratch.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+    if (!Handle->Seek(CompressedStart) || !Handle->Read(CompressedScratch.GetData(), CompressedSize))
+    {
+        return false;
+    }
+
+    // Blocks that are only partially covered by the read (at most the first and the last) are decompressed on the
+    // side, everything else goes straight into the destination
+    TArray64<uint8> PartialBlocks[2];
+    std::atomic bSucceeded = true;
+    ParallelFor(
+        Last - First + 1,
+        [&](const int32 Offset) {
+            const auto Block = First + Offset;
+            const auto BlockStart = Block * Index.BlockSize;
+            const auto BlockEnd = BlockStart + Index.GetUncompressedSize(Block);
+            const auto *Source = CompressedScratch.GetData() + (Index.Offsets[Block] - CompressedStart);
+
+            uint8 *Target;
+            if (BlockStart >= ReadStart && BlockEnd <= ReadEnd)
+            {
+                Target = Destination + (BlockStart - ReadStart);
+            }
+            else
+            {
+                auto &Partial = PartialBlocks[Block == First ? 0 : 1];
+                Partial.SetNumUninitialized(BlockEnd - BlockStart);
+                Target = Partial.GetData();
+            }
+
+            if (!Index.DecompressBlock(Block, Source, Target))
+            {
+                bSucceeded = false;
+            }
+        },
+        First == Last ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    if (!bSucceeded)
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Failed to decompress blocks %d-%d"), First, Last);
+        CachedBlockIndex = INDEX_NONE;
+        return false;
+    }
+
+    for (int32 Slot = 0; Slot < 2; Slot++)
+    {
+        auto &Partial = PartialBlocks[Slot];
+        if (Partial.IsEmpty())
+        {
+            continue;
+        }
+
+        const auto Block = Slot == 0 ? First : Last;
+        const auto BlockStart = Block * Index.BlockSize;
+        const auto CopyStart = FMath::Max(ReadStart, BlockStart);
+        const auto CopyEnd = FMath::Min(ReadEnd, BlockStart + Partial.Num());
+        FMemory::Memcpy(Destination + (CopyStart - ReadStart), Partial.GetData() + (CopyStart - BlockStart),
+                        CopyEnd - CopyStart);
+
+        CachedBlock = MoveTemp(Partial);
+        CachedBlockIndex = Block;
+    }
+
+    Position = ReadEnd;
+    return true;
+}
+
+bool FBlockCompressedFileHandle::Write(const uint8 * /*Source*/, int64 /*BytesToWrite*/)
+{
+    return false;
+}
+
+bool FBlockCompressedFileHandle::Flush(bool /*bFullFlush*/)
+{
+    return true;
+}
+
+bool FBlockCompressedFileHandle::Truncate(int64 /*NewSize*/)
+{
+    return false;
+}
+
+int64 FBlockCompressedFileHandle::Size()
+{
+    return Index.UncompressedSize;
+}
+
+void FBlockCompressedFileHandle::ShrinkBuffers()
+{
+    CompressedScratch.Empty();
+    CachedBlock.Empty();
+    CachedBlockIndex = INDEX_NONE;
+    Handle->ShrinkBuffers();
+}
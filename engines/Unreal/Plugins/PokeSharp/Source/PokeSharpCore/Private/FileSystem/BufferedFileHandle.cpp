@@ -0,0 +1,224 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "FileSystem/BufferedFileHandle.h"
+#include "LogPokeSharpCore.h"
+
+FBufferedFileHandle::FBufferedFileHandle(TUniquePtr<IFileHandle> &&InHandle, const int32 InBufferSize)
+    : Handle(MoveTemp(InHandle)), BufferSize(FMath::Max(InBufferSize, 1))
+{
+    check(Handle != nullptr);
+    Position = Handle->Tell();
+    FileSize = Handle->Size();
+}
+
+FBufferedFileHandle::~FBufferedFileHandle()
+{
+    if (!FlushWriteBuffer())
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Failed to write buffered data while closing a file handle"));
+    }
+}
+
+int64 FBufferedFileHandle::Tell()
+{
+    return Position;
+}
+
+bool FBufferedFileHandle::Seek(const int64 NewPosition)
+{
+    if (NewPosition < 0)
+    {
+        return false;
+    }
+
+    // Seeking is purely logical, the inner handle is only repositioned when data actually needs to move
+    Position = NewPosition;
+    return true;
+}
+
+bool FBufferedFileHandle::SeekFromEnd(const int64 NewPositionRelativeToEnd)
+{
+    if (NewPositionRelativeToEnd > 0)
+    {
+        return false;
+    }
+
+    return Seek(Size() + NewPositionRelativeToEnd);
+}
+
+bool FBufferedFileHandle::Read(uint8 *Destination, int64 BytesToRead)
+{
+    // Anything still sitting in the write buffer has to be visible to the read
+    if (!FlushWriteBuffer())
+    {
+        return false;
+    }
+
+    while (BytesToRead > 0)
+    {
+        const auto BufferedStart = Position - ReadBufferOffset;
+        if (BufferedStart >= 0 && BufferedStart < ReadBuffer.Num())
+        {
+            const auto ToCopy = FMath::Min<int64>(BytesToRead, ReadBuffer.Num() - BufferedStart);
+            FMemory::Memcpy(Destination, ReadBuffer.GetData() + BufferedStart, ToCopy);
+            Destination += ToCopy;
+            BytesToRead -= ToCopy;
+            Position += ToCopy;
+            continue;
+        }
+
+        // Large reads gain nothing from the buffer, so they go straight through to the destination
+        if (BytesToRead >= BufferSize)
+        {
+            if (!Handle->Seek(Position))
+            {
+                return false;
+            }
+
+            const auto Remaining = FMath::Max<int64>(FileSize - Position, 0);
+            const auto ToRead = FMath::Min(BytesToRead, Remaining);
+            if (ToRead > 0 && !Handle->Read(Destination, ToRead))
+            {
+                return false;
+            }
+
+            Position += ToRead;
+            return ToRead == BytesToRead;
+        }
+
+        if (!FillReadBuffer())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FBufferedFileHandle::Write(const uint8 *Source, const int64 BytesToWrite)
+{
+    DiscardReadBuffer();
+
+    // The write buffer only ever holds one contiguous run of bytes
+    if (WriteBuffer.Num() > 0 && Position != WriteBufferOffset + WriteBuffer.Num())
+    {
+        if (!FlushWriteBuffer())
+        {
+            return false;
+        }
+    }
+
+    if (WriteBuffer.Num() + BytesToWrite > BufferSize)
+    {
+        if (!FlushWriteBuffer())
+        {
+            return false;
+        }
+
+        if (BytesToWrite >= BufferSize)
+        {
+            if (!Handle->Seek(Position) || !Handle->Write(Source, BytesToWrite))
+            {
+                return false;
+            }
+
+            Position += BytesToWrite;
+            FileSize = FMath::Max(FileSize, Position);
+            return true;
+        }
+    }
+
+    if (WriteBuffer.Num() == 0)
+    {
+        WriteBuffer.Reserve(BufferSize);
+        WriteBufferOffset = Position;
+    }
+
+    WriteBuffer.Append(Source, BytesToWrite);
+    Position += BytesToWrite;
+    FileSize = FMath::Max(FileSize, Position);
+    return true;
+}
+
+bool FBufferedFileHandle::Flush(const bool bFullFlush)
+{
+    return FlushWriteBuffer() && Handle->Flush(bFullFlush);
+}
+
+bool FBufferedFileHandle::Truncate(const int64 NewSize)
+{
+    if (!FlushWriteBuffer())
+    {
+        return false;
+    }
+
+    DiscardReadBuffer();
+    if (!Handle->Truncate(NewSize))
+    {
+        return false;
+    }
+
+    FileSize = NewSize;
+    return true;
+}
+
+int64 FBufferedFileHandle::Size()
+{
+    // Already accounts for anything still sitting in the write buffer
+    return FileSize;
+}
+
+void FBufferedFileHandle::ShrinkBuffers()
+{
+    DiscardReadBuffer();
+    ReadBuffer.Empty();
+    if (WriteBuffer.Num() == 0)
+    {
+        WriteBuffer.Empty();
+    }
+
+    Handle->ShrinkBuffers();
+}
+
+bool FBufferedFileHandle::FlushWriteBuffer()
+{
+    if (WriteBuffer.Num() == 0)
+    {
+        return true;
+    }
+
+    const bool bWritten = Handle->Seek(WriteBufferOffset) && Handle->Write(WriteBuffer.GetData(), WriteBuffer.Num());
+    WriteBuffer.Reset();
+    return bWritten;
+}
+
+void FBufferedFileHandle::DiscardReadBuffer()
+{
+    ReadBuffer.Reset();
+    ReadBufferOffset = 0;
+}
+
+bool FBufferedFileHandle::FillReadBuffer()
+{
+    DiscardReadBuffer();
+    if (!Handle->Seek(Position))
+    {
+        return false;
+    }
+
+    const auto ToRead = FMath::Min<int64>(BufferSize, FileSize - Position);
+    if (ToRead <= 0)
+    {
+        return false;
+    }
+
+    ReadBuffer.SetNumUninitialized(static_cast<int32>(ToRead), EAllowShrinking::No);
+    if (!Handle->Read(ReadBuffer.GetData(), ToRead))
+    {
+        DiscardReadBuffer();
+        return false;
+    }
+
+    ReadBufferOffset = Position;
+    return true;
+}
@@ -1,7 +1,66 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Interop/ArchiveStreamExporter.h"
+#include "Diagnostics/PokeSharpIOStats.h"
 #include "Interop/FileHandleExporter.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+namespace
+{
+    constexpr int64 CopyBufferSize = 1024 * 1024;
+
+    TArray64<uint8> &GetCopyBuffer()
+    {
+        // One buffer per thread, so concurrent copies never have to allocate or share
+        thread_local TArray64<uint8> Buffer;
+        if (Buffer.Num() < CopyBufferSize)
+        {
+            Buffer.SetNumUninitialized(CopyBufferSize);
+        }
+
+        return Buffer;
+    }
+
+    template <typename FWriteChunk>
+    int64 CopyFromArchive(FArchive &Source, const int64 Length, FWriteChunk &&WriteChunk)
+    {
+        if (!Source.IsLoading())
+        {
+            return INDEX_NONE;
+        }
+
+        // The size and position are only queried once up front, rather than for every chunk
+        auto Remaining = Length;
+        const auto Size = Source.TotalSize();
+        if (const auto Pos = Source.Tell(); Size != INDEX_NONE && Pos != INDEX_NONE)
+        {
+            const auto Available = FMath::Max<int64>(Size - Pos, 0);
+            Remaining = Length < 0 ? Available : FMath::Min(Length, Available);
+        }
+        else if (Length < 0)
+        {
+            // Without a known size there is no way to tell where the end is
+            return INDEX_NONE;
+        }
+
+        auto &Buffer = GetCopyBuffer();
+        int64 Copied = 0;
+        while (Remaining > 0)
+        {
+            const auto Chunk = FMath::Min(Remaining, Buffer.Num());
+            Source.Serialize(Buffer.GetData(), Chunk);
+            if (Source.IsError() || !WriteChunk(Buffer.GetData(), Chunk))
+            {
+                return INDEX_NONE;
+            }
+
+            Copied += Chunk;
+            Remaining -= Chunk;
+        }
+
+        return Copied;
+    }
+} // namespace
 
 void UArchiveStreamExporter::Copy(TSharedRef<FArchive> &Archive, const TSharedRef<FArchive> &OtherArchive)
 {
@@ -10,6 +69,11 @@ void UArchiveStreamExporter::Copy(TSharedRef<FArchive> &Archive, const TSharedRe
 
 void UArchiveStreamExporter::Release(TSharedRef<FArchive> &Archive)
 {
+    if (Archive.IsUnique())
+    {
+        FPokeSharpIOStats::ForgetHandle(&Archive.Get());
+    }
+
     std::destroy_at(&Archive);
 }
 
@@ -40,6 +104,7 @@ int64 UArchiveStreamExporter::GetPosition(FArchive &Archive)
 
 bool UArchiveStreamExporter::SetPosition(FArchive &Archive, const int64 NewPosition)
 {
+    POKESHARP_IO_SCOPE(Archive, Seek, &Archive);
     if (!CanSeek(Archive))
         return false;
     Archive.Seek(NewPosition);
@@ -53,6 +118,7 @@ void UArchiveStreamExporter::Flush(FArchive &Archive)
 
 bool UArchiveStreamExporter::Read(FArchive &Archive, uint8 *Buffer, const int32 Length, int32 &OutRead)
 {
+    POKESHARP_IO_SCOPE(Archive, Read, &Archive);
     if (!Archive.IsLoading())
         return false;
 
@@ -64,6 +130,7 @@ bool UArchiveStreamExporter::Read(FArchive &Archive, uint8 *Buffer, const int32
     {
         Archive.Serialize(Buffer, Length);
         OutRead = Length;
+        PokeSharpIOScope.Bytes = OutRead;
         return true;
     }
 
@@ -82,11 +149,13 @@ bool UArchiveStreamExporter::Read(FArchive &Archive, uint8 *Buffer, const int32
 
     Archive.Serialize(Buffer, ToRead);
     OutRead = ToRead;
+    PokeSharpIOScope.Bytes = OutRead;
     return true;
 }
 
 bool UArchiveStreamExporter::Seek(FArchive &Archive, const int64 Offset, const ESeekOrigin Origin, int64 &NewPosition)
 {
+    POKESHARP_IO_SCOPE(Archive, Seek, &Archive);
     if (!CanSeek(Archive))
         return false;
 
@@ -109,8 +178,39 @@ bool UArchiveStreamExporter::Seek(FArchive &Archive, const int64 Offset, const E
 
 bool UArchiveStreamExporter::Write(FArchive &Archive, uint8 *Buffer, const int32 Size)
 {
+    POKESHARP_IO_SCOPE(Archive, Write, &Archive);
     if (!Archive.IsSaving())
         return false;
     Archive.Serialize(Buffer, Size);
+    PokeSharpIOScope.Bytes = Size;
     return true;
 }
+
+int64 UArchiveStreamExporter::CopyTo(FArchive &Source, FArchive &Destination, const int64 Length)
+{
+    POKESHARP_IO_SCOPE(Archive, Read, &Source);
+    FPokeSharpIOScope DestinationScope(EPokeSharpIOSource::Archive, EPokeSharpIOOperation::Write, &Destination);
+    if (!Destination.IsSaving())
+        return INDEX_NONE;
+
+    const auto Copied = CopyFromArchive(Source, Length, [&Destination](uint8 *Data, const int64 Size) {
+        Destination.Serialize(Data, Size);
+        return !Destination.IsError();
+    });
+    PokeSharpIOScope.Bytes = DestinationScope.Bytes = FMath::Max<int64>(Copied, 0);
+    return Copied;
+}
+
+int64 UArchiveStreamExporter::CopyToFileHandle(FArchive &Source, IFileHandle *Destination, const int64 Length)
+{
+    POKESHARP_IO_SCOPE(Archive, Read, &Source);
+    FPokeSharpIOScope DestinationScope(EPokeSharpIOSource::FileHandle, EPokeSharpIOOperation::Write, Destination);
+    if (Destination == nullptr)
+        return INDEX_NONE;
+
+    const auto Copied = CopyFromArchive(Source, Length, [Destination](const uint8 *Data, const int64 Size) {
+        return Destination->Write(Data, Size);
+    });
+    PokeSharpIOScope.Bytes = DestinationScope.Bytes = FMath::Max<int64>(Copied, 0);
+    return Copied;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/AsyncFileExporter.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interop/PlatformFileExporter.h"
+
+FPokeSharpAsyncFileRequest::~FPokeSharpAsyncFileRequest()
+{
+    Delegate.Dispose();
+}
+
+void FPokeSharpAsyncFileRequest::OnCompleted(const bool bWasCancelled, IAsyncReadRequest *CompletedRequest)
+{
+    if (!bWasCancelled)
+    {
+        if (bSizeRequest)
+        {
+            const auto Size = static_cast<IAsyncSizeRequest *>(CompletedRequest)->GetSizeResults();
+            Result = Size;
+            bSucceeded = Size != INDEX_NONE;
+        }
+        else
+        {
+            bSucceeded = true;
+        }
+    }
+
+    Signal();
+}
+
+void FPokeSharpAsyncFileRequest::Publish(IAsyncReadRequest *IssuedRequest)
+{
+    Request.store(IssuedRequest, std::memory_order_release);
+    Signal();
+}
+
+void FPokeSharpAsyncFileRequest::Signal()
+{
+    if (PendingSignals.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // This runs on whichever thread got here last, the managed side only signals a task from here
+        Delegate.Invoke(nullptr, false);
+    }
+}
+
+IAsyncReadFileHandle *UAsyncFileExporter::OpenRead(const TCHAR *FileName)
+{
+    const auto AbsolutePath = UPlatformFileExporter::ConvertToContentDirPath(FileName);
+    if (AbsolutePath.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    return FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*AbsolutePath);
+}
+
+FPokeSharpAsyncFileRequest *UAsyncFileExporter::RequestSize(IAsyncReadFileHandle *Handle,
+                                                            const FGCHandleIntPtr Callback)
+{
+    auto *Request = new FPokeSharpAsyncFileRequest(FGCHandle(Callback, GCHandleType::StrongHandle));
+    Request->bSizeRequest = true;
+
+    FAsyncFileCallBack CompletionCallback = [Request](const bool bWasCancelled, IAsyncReadRequest *Completed)
+    { Request->OnCompleted(bWasCancelled, Completed); };
+    Request->Publish(Handle->SizeRequest(&CompletionCallback));
+    return Request;
+}
+
+FPokeSharpAsyncFileRequest *UAsyncFileExporter::RequestRead(IAsyncReadFileHandle *Handle,
+                                                            const int64 Offset,
+                                                            const int64 Size,
+                                                            uint8 *Buffer,
+                                                            const bool bPrecache,
+                                                            const FGCHandleIntPtr Callback)
+{
+    auto *Request = new FPokeSharpAsyncFileRequest(FGCHandle(Callback, GCHandleType::StrongHandle));
+    Request->Result = Size;
+
+    FAsyncFileCallBack CompletionCallback = [Request](const bool bWasCancelled, IAsyncReadRequest *Completed)
+    { Request->OnCompleted(bWasCancelled, Completed); };
+    Request->Publish(bPrecache ? Handle->ReadRequest(Offset, Size, AIOP_Precache, &CompletionCallback)
+                               : Handle->ReadRequest(Offset, Size, AIOP_Normal, &CompletionCallback, Buffer));
+    return Request;
+}
+
+void UAsyncFileExporter::Cancel(FPokeSharpAsyncFileRequest *Request)
+{
+    // Managed code only gets hold of the request once it has been published
+    Request->Request.load(std::memory_order_acquire)->Cancel();
+}
+
+bool UAsyncFileExporter::Finish(FPokeSharpAsyncFileRequest *Request, int64 &OutResult)
+{
+    // The completion callback has already fired and the request has been published at this point, but the request is
+    // only safe to delete once it reports itself as complete
+    auto *IssuedRequest = Request->Request.load(std::memory_order_acquire);
+    IssuedRequest->WaitCompletion();
+    delete IssuedRequest;
+
+    const bool bSucceeded = Request->bSucceeded;
+    OutResult = bSucceeded ? Request->Result.load() : 0;
+    delete Request;
+    return bSucceeded;
+}
+
+void UAsyncFileExporter::Close(const IAsyncReadFileHandle *Handle)
+{
+    delete Handle;
+}
@@ -0,0 +1,32 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/DataArchiveExporter.h"
+#include "Data/PokeSharpDataArchive.h"
+#include "Interop/PlatformFileExporter.h"
+
+bool UDataArchiveExporter::Open(const TCHAR *FileName, TSharedPtr<FPokeSharpDataArchive> &OutArchive)
+{
+    const auto AbsolutePath = UPlatformFileExporter::ConvertToContentDirPath(FileName);
+    auto Archive = !AbsolutePath.IsEmpty() ? FPokeSharpDataArchive::Open(AbsolutePath) : nullptr;
+
+    // The managed side hands us uninitialized memory, so the pointer has to be constructed in place
+    std::construct_at(&OutArchive, MoveTemp(Archive));
+    return OutArchive.IsValid();
+}
+
+void UDataArchiveExporter::Release(TSharedPtr<FPokeSharpDataArchive> &Archive)
+{
+    std::destroy_at(&Archive);
+}
+
+bool UDataArchiveExporter::Contains(const FPokeSharpDataArchive &Archive, const UTF16CHAR *Name, const int32 Length)
+{
+    const auto EntryName = StringCast<TCHAR>(Name, Length);
+    return Archive.FindEntry(FStringView(EntryName.Get(), EntryName.Length())) != nullptr;
+}
+
+IFileHandle *UDataArchiveExporter::OpenEntry(FPokeSharpDataArchive &Archive, const UTF16CHAR *Name, const int32 Length)
+{
+    const auto EntryName = StringCast<TCHAR>(Name, Length);
+    return Archive.OpenEntry(FStringView(EntryName.Get(), EntryName.Length()));
+}
@@ -0,0 +1,46 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/DataPreloaderExporter.h"
+#include "Data/PokeSharpDataPreloader.h"
+#include "Interop/PlatformFileExporter.h"
+
+namespace
+{
+    FString GetAbsolutePath(const UTF16CHAR *FilePath, const int32 Length)
+    {
+        const auto Path = StringCast<TCHAR>(FilePath, Length);
+        return UPlatformFileExporter::ConvertToContentDirPath(*FString(Path.Length(), Path.Get()));
+    }
+} // namespace
+
+TArray64<uint8> *UDataPreloaderExporter::Claim(const UTF16CHAR *FilePath,
+                                               const int32 Length,
+                                               const uint8 *&OutData,
+                                               int64 &OutSize)
+{
+    const auto AbsolutePath = GetAbsolutePath(FilePath, Length);
+    auto Buffer = AbsolutePath.IsEmpty() ? nullptr : FPokeSharpDataPreloader::Get().Claim(AbsolutePath);
+    if (Buffer == nullptr)
+    {
+        OutData = nullptr;
+        OutSize = 0;
+        return nullptr;
+    }
+
+    OutData = Buffer->GetData();
+    OutSize = Buffer->Num();
+    return Buffer.Release();
+}
+
+void UDataPreloaderExporter::Release(const TArray64<uint8> *Buffer)
+{
+    delete Buffer;
+}
+
+void UDataPreloaderExporter::Discard(const UTF16CHAR *FilePath, const int32 Length)
+{
+    if (const auto AbsolutePath = GetAbsolutePath(FilePath, Length); !AbsolutePath.IsEmpty())
+    {
+        FPokeSharpDataPreloader::Get().Discard(AbsolutePath);
+    }
+}
@@ -1,8 +1,62 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Interop/FileHandleExporter.h"
+#include "Diagnostics/PokeSharpIOStats.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 
+namespace
+{
+    /**
+     * A run of vectors that are back-to-back in the file, stored as a span over the offset-sorted order.
+     */
+    struct FCoalescedRun
+    {
+        TArrayView<const int32> Indices;
+        int64 Offset;
+        int64 Length;
+        bool bContiguousBuffers;
+    };
+
+    template <typename FunctorType>
+    bool ForEachCoalescedRun(const FFileIOVector *Vectors, const int32 Count, FunctorType &&Functor)
+    {
+        TArray<int32, TInlineAllocator<64>> Order;
+        Order.SetNumUninitialized(Count);
+        for (int32 i = 0; i < Count; i++)
+        {
+            Order[i] = i;
+        }
+        Order.StableSort([Vectors](const int32 A, const int32 B) { return Vectors[A].Offset < Vectors[B].Offset; });
+
+        bool bSucceeded = true;
+        for (int32 Start = 0; Start < Count;)
+        {
+            const auto &First = Vectors[Order[Start]];
+            FCoalescedRun Run{.Offset = First.Offset, .Length = First.Length, .bContiguousBuffers = true};
+
+            int32 End = Start + 1;
+            for (; End < Count; End++)
+            {
+                const auto &Previous = Vectors[Order[End - 1]];
+                const auto &Next = Vectors[Order[End]];
+                if (Next.Offset != Run.Offset + Run.Length)
+                {
+                    break;
+                }
+
+                Run.bContiguousBuffers &= Next.Buffer == Previous.Buffer + Previous.Length;
+                Run.Length += Next.Length;
+            }
+
+            Run.Indices = TArrayView<const int32>(Order.GetData() + Start, End - Start);
+            bSucceeded &= Functor(Run);
+            Start = End;
+        }
+
+        return bSucceeded;
+    }
+} // namespace
+
 int64 UFileHandleExporter::GetSize(IFileHandle *Handle)
 {
     return Handle->Size();
@@ -20,19 +74,26 @@ bool UFileHandleExporter::Flush(IFileHandle *Handle)
 
 bool UFileHandleExporter::Read(IFileHandle *Handle, uint8 *Buffer, const int32 Size, int32 &OutRead)
 {
+    POKESHARP_IO_SCOPE(FileHandle, Read, Handle);
     const auto CurrentPosition = Handle->Tell();
-    if (!Handle->Read(Buffer, Size))
+
+    // Clamp to the end of the file so the final, partial chunk of a stream read is not reported as a failure. Buffered
+    // handles keep their size cached, so this does not touch the file system.
+    const auto ToRead = FMath::Min<int64>(Size, FMath::Max<int64>(Handle->Size() - CurrentPosition, 0));
+    if (ToRead > 0 && !Handle->Read(Buffer, ToRead))
     {
         OutRead = 0;
         return false;
     }
 
     OutRead = static_cast<int32>(Handle->Tell() - CurrentPosition);
+    PokeSharpIOScope.Bytes = OutRead;
     return true;
 }
 
 bool UFileHandleExporter::Seek(IFileHandle *Handle, const uint64 Offset, const ESeekOrigin Origin, int64 &NewPosition)
 {
+    POKESHARP_IO_SCOPE(FileHandle, Seek, Handle);
     bool Result = false;
     switch (Origin)
     {
@@ -64,10 +125,100 @@ bool UFileHandleExporter::SetLength(IFileHandle *Handle, const uint64 NewLength)
 
 bool UFileHandleExporter::Write(IFileHandle *Handle, const uint8 *Buffer, const int32 Size)
 {
-    return Handle->Write(Buffer, Size);
+    POKESHARP_IO_SCOPE(FileHandle, Write, Handle);
+    const bool bWritten = Handle->Write(Buffer, Size);
+    PokeSharpIOScope.Bytes = bWritten ? Size : 0;
+    return bWritten;
 }
 
 void UFileHandleExporter::Close(const IFileHandle *Handle)
 {
+    FPokeSharpIOStats::ForgetHandle(Handle);
     delete Handle;
+}
+
+bool UFileHandleExporter::ReadVector(IFileHandle *Handle, FFileIOVector *Vectors, const int32 Count)
+{
+    POKESHARP_IO_SCOPE(FileHandle, Read, Handle);
+    const auto OriginalPosition = Handle->Tell();
+    const auto FileSize = Handle->Size();
+    TArray64<uint8> Scratch;
+
+    const bool bSucceeded = ForEachCoalescedRun(
+        Vectors,
+        Count,
+        [&](const FCoalescedRun &Run)
+        {
+            const auto ToRead = FMath::Clamp<int64>(FileSize - Run.Offset, 0, Run.Length);
+            uint8 *Destination = Vectors[Run.Indices[0]].Buffer;
+            if (!Run.bContiguousBuffers)
+            {
+                Scratch.SetNumUninitialized(ToRead, EAllowShrinking::No);
+                Destination = Scratch.GetData();
+            }
+
+            const bool bRead = ToRead == 0 || (Handle->Seek(Run.Offset) && Handle->Read(Destination, ToRead));
+            auto Remaining = bRead ? ToRead : 0;
+            for (const auto Index : Run.Indices)
+            {
+                auto &Vector = Vectors[Index];
+                Vector.BytesTransferred = FMath::Min(Vector.Length, Remaining);
+                if (!Run.bContiguousBuffers && Vector.BytesTransferred > 0)
+                {
+                    FMemory::Memcpy(Vector.Buffer, Destination, Vector.BytesTransferred);
+                    Destination += Vector.BytesTransferred;
+                }
+                Remaining -= Vector.BytesTransferred;
+            }
+
+            return bRead && ToRead == Run.Length;
+        });
+
+    Handle->Seek(OriginalPosition);
+    for (int32 i = 0; i < Count; i++)
+    {
+        PokeSharpIOScope.Bytes += Vectors[i].BytesTransferred;
+    }
+
+    return bSucceeded;
+}
+
+bool UFileHandleExporter::WriteVector(IFileHandle *Handle, FFileIOVector *Vectors, const int32 Count)
+{
+    POKESHARP_IO_SCOPE(FileHandle, Write, Handle);
+    const auto OriginalPosition = Handle->Tell();
+    TArray64<uint8> Scratch;
+
+    const bool bSucceeded = ForEachCoalescedRun(
+        Vectors,
+        Count,
+        [&](const FCoalescedRun &Run)
+        {
+            const uint8 *Source = Vectors[Run.Indices[0]].Buffer;
+            if (!Run.bContiguousBuffers)
+            {
+                Scratch.Reset(Run.Length);
+                for (const auto Index : Run.Indices)
+                {
+                    Scratch.Append(Vectors[Index].Buffer, Vectors[Index].Length);
+                }
+                Source = Scratch.GetData();
+            }
+
+            const bool bWritten = Run.Length == 0 || (Handle->Seek(Run.Offset) && Handle->Write(Source, Run.Length));
+            for (const auto Index : Run.Indices)
+            {
+                Vectors[Index].BytesTransferred = bWritten ? Vectors[Index].Length : 0;
+            }
+
+            return bWritten;
+        });
+
+    Handle->Seek(OriginalPosition);
+    for (int32 i = 0; i < Count; i++)
+    {
+        PokeSharpIOScope.Bytes += Vectors[i].BytesTransferred;
+    }
+
+    return bSucceeded;
 }
\ No newline at end of file
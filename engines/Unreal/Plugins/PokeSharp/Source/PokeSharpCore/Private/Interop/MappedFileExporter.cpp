@@ -0,0 +1,59 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/MappedFileExporter.h"
+#include "Async/MappedFileHandle.h"
+#include "FileSystem/BlockCompressedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interop/PlatformFileExporter.h"
+#include "LogPokeSharpCore.h"
+
+FPokeSharpMappedFile *UMappedFileExporter::Open(const TCHAR *FileName, const uint8 *&OutData, int64 &OutSize)
+{
+    OutData = nullptr;
+    OutSize = 0;
+
+    const auto AbsolutePath = UPlatformFileExporter::ConvertToContentDirPath(FileName);
+    if (AbsolutePath.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    TUniquePtr<IMappedFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*AbsolutePath));
+    if (Handle == nullptr)
+    {
+        UE_LOG(LogPokeSharpCore, Verbose, TEXT("Memory mapping is not available for %s"), *AbsolutePath);
+        return nullptr;
+    }
+
+    // Mapping an empty region is not supported on every platform, so an empty file is handed back without one
+    const auto FileSize = Handle->GetFileSize();
+    TUniquePtr<IMappedFileRegion> Region;
+    if (FileSize > 0)
+    {
+        Region.Reset(Handle->MapRegion(0, FileSize));
+        if (Region == nullptr)
+        {
+            UE_LOG(LogPokeSharpCore, Warning, TEXT("Failed to map %s into memory"), *AbsolutePath);
+            return nullptr;
+        }
+
+        // Block-compressed files have to go through the decompressing file handle instead
+        if (FBlockCompressedFileHandle::IsBlockCompressed(
+                TConstArrayView64<uint8>(Region->GetMappedPtr(), Region->GetMappedSize())))
+        {
+            UE_LOG(LogPokeSharpCore, Verbose, TEXT("%s is block-compressed and cannot be mapped"), *AbsolutePath);
+            return nullptr;
+        }
+
+        OutData = Region->GetMappedPtr();
+        OutSize = Region->GetMappedSize();
+    }
+
+    return new FPokeSharpMappedFile{MoveTemp(Handle), MoveTemp(Region)};
+}
+
+void UMappedFileExporter::Close(const FPokeSharpMappedFile *MappedFile)
+{
+    // The region must be released before the handle that owns it, which the member order already guarantees
+    delete MappedFile;
+}
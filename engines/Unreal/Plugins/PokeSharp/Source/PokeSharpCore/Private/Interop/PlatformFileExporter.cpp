@@ -1,26 +1,47 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Interop/PlatformFileExporter.h"
+#include "FileSystem/BlockCompressedFileHandle.h"
+#include "FileSystem/BufferedFileHandle.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/PackageName.h"
 
-IFileHandle *UPlatformFileExporter::OpenRead(const TCHAR *FileName, const bool bAllowWrite)
+IFileHandle *UPlatformFileExporter::OpenRead(const TCHAR *FileName, const bool bAllowWrite, const int32 BufferSize)
 {
-    auto &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const auto AbsolutePath = ConvertToContentDirPath(FileName);
+    if (AbsolutePath.IsEmpty())
+    {
+        return nullptr;
+    }
 
-    if (FString AbsolutePath; FPackageName::TryConvertLongPackageNameToFilename(FString(FileName), AbsolutePath))
+    auto *Handle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*AbsolutePath, bAllowWrite);
+    if (Handle != nullptr && !bAllowWrite && FBlockCompressedFileHandle::IsBlockCompressed(*Handle))
     {
-        return PlatformFile.OpenRead(AbsolutePath.GetCharArray().GetData(), bAllowWrite);
+        // The decompressing handle keeps its own block cache, so it doesn't need a buffer in front of it
+        return FBlockCompressedFileHandle::Open(TUniquePtr<IFileHandle>(Handle)).Release();
     }
 
-    return nullptr;
+    return WrapHandle(Handle, BufferSize);
+}
+
+bool UPlatformFileExporter::IsBlockCompressed(const TCHAR *FileName)
+{
+    const auto AbsolutePath = ConvertToContentDirPath(FileName);
+    if (AbsolutePath.IsEmpty())
+    {
+        return false;
+    }
+
+    const TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*AbsolutePath));
+    return Handle != nullptr && FBlockCompressedFileHandle::IsBlockCompressed(*Handle);
 }
 
 IFileHandle *UPlatformFileExporter::OpenWrite(const TCHAR *FileName,
                                               const bool bAppend,
                                               const bool bAllowRead,
-                                              const bool bOverwrite)
+                                              const bool bOverwrite,
+                                              const int32 BufferSize)
 {
     auto &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
     if (!bOverwrite && PlatformFile.FileExists(FileName))
@@ -30,7 +51,27 @@ IFileHandle *UPlatformFileExporter::OpenWrite(const TCHAR *FileName,
 
     if (FString AbsolutePath; FPackageName::TryConvertLongPackageNameToFilename(FString(FileName), AbsolutePath))
     {
-        return PlatformFile.OpenWrite(FileName, bAppend, bAllowRead);
+        return WrapHandle(PlatformFile.OpenWrite(FileName, bAppend, bAllowRead), BufferSize);
     }
     return nullptr;
+}
+
+FString UPlatformFileExporter::ConvertToContentDirPath(const TCHAR *FileName)
+{
+    if (FString AbsolutePath; FPackageName::TryConvertLongPackageNameToFilename(FString(FileName), AbsolutePath))
+    {
+        return AbsolutePath;
+    }
+
+    return FString();
+}
+
+IFileHandle *UPlatformFileExporter::WrapHandle(IFileHandle *Handle, const int32 BufferSize)
+{
+    if (Handle == nullptr || BufferSize <= 0)
+    {
+        return Handle;
+    }
+
+    return new FBufferedFileHandle(TUniquePtr<IFileHandle>(Handle), BufferSize);
 }
\ No newline at end of file
@@ -0,0 +1,25 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/PokeSharpIOStatsExporter.h"
+#include "Diagnostics/PokeSharpIOStats.h"
+
+void UPokeSharpIOStatsExporter::GetSnapshot(const EPokeSharpIOSource Source, FPokeSharpIOSnapshot &OutSnapshot)
+{
+    if (Source >= EPokeSharpIOSource::Num)
+    {
+        OutSnapshot = FPokeSharpIOSnapshot();
+        return;
+    }
+
+    FPokeSharpIOStats::GetSnapshot(Source, OutSnapshot);
+}
+
+bool UPokeSharpIOStatsExporter::GetHandleSnapshot(const void *Handle, FPokeSharpIOSnapshot &OutSnapshot)
+{
+    return FPokeSharpIOStats::GetHandleSnapshot(Handle, OutSnapshot);
+}
+
+void UPokeSharpIOStatsExporter::Reset()
+{
+    FPokeSharpIOStats::Reset();
+}
@@ -2,6 +2,28 @@
 
 #include "Interop/PokeSharpNameExporter.h"
 
+namespace
+{
+    template <typename CharType>
+    void InternNames(const CharType *Buffer,
+                     const int32 *Offsets,
+                     const int32 Count,
+                     const EFindName FindType,
+                     uint32 *ComparisonIndices,
+                     uint32 *DisplayIndices,
+                     int32 *Numbers)
+    {
+        for (int32 i = 0; i < Count; i++)
+        {
+            const auto Name = FName(TStringView(Buffer + Offsets[i], Offsets[i + 1] - Offsets[i]), FindType);
+            FPokeSharpNameDisplayTable::Get().Register(Name);
+            ComparisonIndices[i] = Name.GetComparisonIndex().ToUnstableInt();
+            DisplayIndices[i] = Name.GetDisplayIndex().ToUnstableInt();
+            Numbers[i] = Name.GetNumber();
+        }
+    }
+} // namespace
+
 void UPokeSharpNameExporter::GetOrAddEntry(const UTF16CHAR *Str,
                                            const int32 Length,
                                            const bool FindMode,
@@ -10,11 +32,34 @@ void UPokeSharpNameExporter::GetOrAddEntry(const UTF16CHAR *Str,
                                            int32 &Number)
 {
     const auto Name = FName(TStringView(Str, Length), FindMode ? FNAME_Find : FNAME_Add);
+    FPokeSharpNameDisplayTable::Get().Register(Name);
     ComparisonIndex = Name.GetComparisonIndex().ToUnstableInt();
     DisplayIndex = Name.GetDisplayIndex().ToUnstableInt();
     Number = Name.GetNumber();
 }
 
+void UPokeSharpNameExporter::GetOrAddEntries(const UTF16CHAR *Buffer,
+                                             const int32 *Offsets,
+                                             const int32 Count,
+                                             const bool FindMode,
+                                             uint32 *ComparisonIndices,
+                                             uint32 *DisplayIndices,
+                                             int32 *Numbers)
+{
+    InternNames(Buffer, Offsets, Count, FindMode ? FNAME_Find : FNAME_Add, ComparisonIndices, DisplayIndices, Numbers);
+}
+
+void UPokeSharpNameExporter::GetOrAddEntriesUtf8(const UTF8CHAR *Buffer,
+                                                 const int32 *Offsets,
+                                                 const int32 Count,
+                                                 const bool FindMode,
+                                                 uint32 *ComparisonIndices,
+                                                 uint32 *DisplayIndices,
+                                                 int32 *Numbers)
+{
+    InternNames(Buffer, Offsets, Count, FindMode ? FNAME_Find : FNAME_Add, ComparisonIndices, DisplayIndices, Numbers);
+}
+
 bool UPokeSharpNameExporter::IsValid(const uint32 ComparisonIndex, const uint32 DisplayIndex)
 {
     const auto Name = GetName(ComparisonIndex, DisplayIndex, 0);
@@ -39,11 +84,42 @@ void UPokeSharpNameExporter::GetString(const uint32 ComparisonIndex,
     OutString = GetName(ComparisonIndex, DisplayIndex, Number).ToString();
 }
 
+int32 UPokeSharpNameExporter::GetPlainName(const uint32 ComparisonIndex,
+                                           const uint32 DisplayIndex,
+                                           uint8 *Buffer,
+                                           bool &bOutWide)
+{
+    static_assert(sizeof(WIDECHAR) == sizeof(UTF16CHAR), "Wide name entries are handed to managed code as UTF-16");
+    static_assert(NAME_SIZE == 1024, "UnrealNameProvider.NameSize must match NAME_SIZE");
+
+    const auto Name = GetName(ComparisonIndex, DisplayIndex, 0);
+    FPokeSharpNameDisplayTable::Get().Register(Name);
+
+    const auto *Entry = Name.GetDisplayNameEntry();
+    bOutWide = Entry->IsWide();
+    if (bOutWide)
+    {
+        Entry->GetWideName(*reinterpret_cast<WIDECHAR(*)[NAME_SIZE]>(Buffer));
+    }
+    else
+    {
+        Entry->GetAnsiName(*reinterpret_cast<ANSICHAR(*)[NAME_SIZE]>(Buffer));
+    }
+
+    return Entry->GetNameLength();
+}
+
+void UPokeSharpNameExporter::GetDisplayTable(FPokeSharpNameDisplayTableView &OutView)
+{
+    FPokeSharpNameDisplayTable::Get().GetView(OutView);
+}
+
 void UPokeSharpNameExporter::FromUnrealName(const FName Name,
                                             uint32 &ComparisonIndex,
                                             uint32 &DisplayIndex,
                                             int32 &Number)
 {
+    FPokeSharpNameDisplayTable::Get().Register(Name);
     ComparisonIndex = Name.GetComparisonIndex().ToUnstableInt();
     DisplayIndex = Name.GetDisplayIndex().ToUnstableInt();
     Number = Name.GetNumber();
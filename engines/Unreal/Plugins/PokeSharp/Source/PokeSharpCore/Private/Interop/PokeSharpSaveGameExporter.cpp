@@ -1,20 +1,53 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Interop/PokeSharpSaveGameExporter.h"
+#include "Diagnostics/PokeSharpIOStats.h"
 #include "Saving/PokeSharpSaveGame.h"
 
 void UPokeSharpSaveGameExporter::GetDataReadBuffer(const UPokeSharpSaveGame *SaveGame,
                                                    const uint8 *&OutBuffer,
                                                    int32 &OutSize)
 {
+    POKESHARP_IO_SCOPE(SaveGame, Read, SaveGame);
     const auto DataView = SaveGame->GetData();
     OutBuffer = DataView.GetData();
     OutSize = DataView.Num();
+    PokeSharpIOScope.Bytes = OutSize;
 }
 
 void UPokeSharpSaveGameExporter::WriteToDataBuffer(UPokeSharpSaveGame *SaveGame, const uint8 *Buffer, const int32 Size)
 {
+    POKESHARP_IO_SCOPE(SaveGame, Write, SaveGame);
+    PokeSharpIOScope.Bytes = Size;
+
     // ReSharper disable once CppTemplateArgumentsCanBeDeduced
     const auto ArrayView = TConstArrayView<uint8>(Buffer, Size);
     SaveGame->WriteData(ArrayView);
+}
+
+void UPokeSharpSaveGameExporter::ReserveDataBuffer(UPokeSharpSaveGame *SaveGame, const int32 Capacity)
+{
+    SaveGame->ReserveData(Capacity);
+}
+
+void UPokeSharpSaveGameExporter::GetWriteSpan(UPokeSharpSaveGame *SaveGame,
+                                              const int32 MinSize,
+                                              uint8 *&OutBuffer,
+                                              int32 &OutSize)
+{
+    const auto Span = SaveGame->GetWriteSpan(MinSize);
+    OutBuffer = Span.GetData();
+    OutSize = Span.Num();
+}
+
+bool UPokeSharpSaveGameExporter::CommitWrite(UPokeSharpSaveGame *SaveGame, const int32 Bytes)
+{
+    POKESHARP_IO_SCOPE(SaveGame, Write, SaveGame);
+    if (!SaveGame->CommitData(Bytes))
+    {
+        return false;
+    }
+
+    PokeSharpIOScope.Bytes = Bytes;
+    return true;
 }
\ No newline at end of file
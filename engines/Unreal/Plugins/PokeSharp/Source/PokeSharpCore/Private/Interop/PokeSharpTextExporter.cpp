@@ -1,6 +1,7 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Interop/PokeSharpTextExporter.h"
+#include "Strings/PokeSharpTextCache.h"
 
 void UPokeSharpTextExporter::FromSourceString(const UTF16CHAR *Buffer, const int32 Length, FText &OutText)
 {
@@ -15,19 +16,70 @@ void UPokeSharpTextExporter::FromLocalized(const UTF16CHAR *NamespaceBuffer,
                                            const int32 StrLength,
                                            FText &OutText)
 {
-    OutText = FText::AsLocalizable_Advanced(FTextKey(TStringView(NamespaceBuffer, NamespaceLength)),
-                                            FTextKey(TStringView(KeyBuffer, KeyLength)),
-                                            TStringView(StrBuffer, StrLength));
+    FPokeSharpTextCache::Get().FindOrAddLocalized(TStringView(NamespaceBuffer, NamespaceLength),
+                                                  TStringView(KeyBuffer, KeyLength),
+                                                  TStringView(StrBuffer, StrLength),
+                                                  OutText);
 }
 
 void UPokeSharpTextExporter::FromLocText(const TCHAR *StrBuffer, const int32 StrLength, FText &OutText)
 {
-    if (!FTextStringHelper::ReadFromBuffer(StrBuffer, OutText))
+    FPokeSharpTextCache::Get().FindOrAddLocText(FStringView(StrBuffer, StrLength), OutText);
+}
+
+void UPokeSharpTextExporter::FromLocalizedBatch(const UTF16CHAR *NamespaceBuffer,
+                                                const int32 NamespaceLength,
+                                                const UTF16CHAR *KeysBuffer,
+                                                const int32 *KeyOffsets,
+                                                const UTF16CHAR *SourcesBuffer,
+                                                const int32 *SourceOffsets,
+                                                const int32 Count,
+                                                int32 *OutHandles,
+                                                FText *OutTexts)
+{
+    auto &Cache = FPokeSharpTextCache::Get();
+    const TStringView Namespace(NamespaceBuffer, NamespaceLength);
+    FText Text;
+    for (int32 i = 0; i < Count; i++)
     {
-        OutText = FText::FromStringView(FStringView(StrBuffer, StrLength));
+        const TStringView Key(KeysBuffer + KeyOffsets[i], KeyOffsets[i + 1] - KeyOffsets[i]);
+        const TStringView Source(SourcesBuffer + SourceOffsets[i], SourceOffsets[i + 1] - SourceOffsets[i]);
+        const auto Handle = Cache.FindOrAddLocalized(Namespace, Key, Source, Text);
+        if (OutHandles != nullptr)
+        {
+            OutHandles[i] = Handle;
+        }
+
+        if (OutTexts != nullptr)
+        {
+            OutTexts[i] = Text;
+        }
     }
 }
 
+void UPokeSharpTextExporter::FromStringTable(const FName TableId,
+                                             const UTF16CHAR *KeyBuffer,
+                                             const int32 KeyLength,
+                                             FText &OutText)
+{
+    FPokeSharpTextCache::Get().FindOrAddStringTableEntry(TableId, TStringView(KeyBuffer, KeyLength), OutText);
+}
+
+int32 UPokeSharpTextExporter::PreloadStringTable(const FName TableId)
+{
+    return FPokeSharpTextCache::Get().PreloadStringTable(TableId);
+}
+
+bool UPokeSharpTextExporter::FromHandle(const int32 Handle, FText &OutText)
+{
+    return FPokeSharpTextCache::Get().TryGetText(Handle, OutText);
+}
+
+const uint32 *UPokeSharpTextExporter::GetCultureGeneration()
+{
+    return FPokeSharpTextCache::Get().GetCultureGeneration();
+}
+
 void UPokeSharpTextExporter::ToLocText(const FText &Text, FString &OutStr)
 {
     FTextStringHelper::WriteToBuffer(OutStr, Text);
@@ -103,3 +155,36 @@ void UPokeSharpTextExporter::AsDisplaySpan(const FText &Text, const TCHAR *&OutB
     OutBuffer = AsString.GetCharArray().GetData();
     OutLength = AsString.Len();
 }
+
+void UPokeSharpTextExporter::PinDisplayString(const FText &Text,
+                                              FTextConstDisplayStringPtr &OutPin,
+                                              const TCHAR *&OutBuffer,
+                                              int32 &OutLength)
+{
+    // The managed side hands us uninitialized memory, so the pointer has to be constructed in place
+    std::construct_at(&OutPin, FTextInspector::GetSharedDisplayString(Text));
+    OutBuffer = OutPin->GetCharArray().GetData();
+    OutLength = OutPin->Len();
+}
+
+void UPokeSharpTextExporter::UnpinDisplayString(FTextConstDisplayStringPtr &Pin)
+{
+    std::destroy_at(&Pin);
+}
+
+void UPokeSharpTextExporter::PinDisplayStrings(const FText *Texts,
+                                               const int32 Count,
+                                               FTextConstDisplayStringPtr *OutPins,
+                                               const TCHAR **OutBuffers,
+                                               int32 *OutLengths)
+{
+    for (int32 i = 0; i < Count; i++)
+    {
+        PinDisplayString(Texts[i], OutPins[i], OutBuffers[i], OutLengths[i]);
+    }
+}
+
+void UPokeSharpTextExporter::UnpinDisplayStrings(FTextConstDisplayStringPtr *Pins, const int32 Count)
+{
+    std::destroy_n(Pins, Count);
+}
@@ -0,0 +1,167 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/SavePipelineExporter.h"
+#include "Diagnostics/PokeSharpIOStats.h"
+#include "Saving/PokeSharpSaveContainer.h"
+
+FPokeSharpSaveRequest::FPokeSharpSaveRequest(const FGCHandle &InProgressDelegate, const FGCHandle &InCompletionDelegate)
+    : Snapshot(MakeShared<FPokeSharpSaveSnapshot>()), ProgressDelegate(InProgressDelegate),
+      CompletionDelegate(InCompletionDelegate)
+{
+}
+
+FPokeSharpSaveRequest::~FPokeSharpSaveRequest()
+{
+    ProgressDelegate.Dispose();
+    CompletionDelegate.Dispose();
+}
+
+bool USavePipelineExporter::IsContainerSupported()
+{
+    return FPokeSharpSaveContainer::IsSupported();
+}
+
+FPokeSharpSaveRequest *USavePipelineExporter::CreateRequest(const FGCHandleIntPtr ProgressCallback,
+                                                            const FGCHandleIntPtr CompletionCallback)
+{
+    return new FPokeSharpSaveRequest(FGCHandle(ProgressCallback, GCHandleType::StrongHandle),
+                                     FGCHandle(CompletionCallback, GCHandleType::StrongHandle));
+}
+
+void USavePipelineExporter::AddSection(FPokeSharpSaveRequest *Request,
+                                       const UTF16CHAR *Name,
+                                       const int32 NameLength,
+                                       const uint8 *Data,
+                                       const int64 Size)
+{
+    const auto SectionName = StringCast<TCHAR>(Name, NameLength);
+    Request->Snapshot->AddSection(FString(SectionName.Length(), SectionName.Get()),
+                                  TConstArrayView64<uint8>(Data, Size));
+}
+
+void USavePipelineExporter::SetSummary(FPokeSharpSaveRequest *Request,
+                                       const UTF16CHAR *PlayerName,
+                                       const int32 PlayerNameLength,
+                                       const double PlayTimeSeconds,
+                                       const int64 Badges,
+                                       const int64 TimestampTicks,
+                                       const UTF16CHAR *GameVersion,
+                                       const int32 GameVersionLength)
+{
+    const auto PlayerNameString = StringCast<TCHAR>(PlayerName, PlayerNameLength);
+    const auto GameVersionString = StringCast<TCHAR>(GameVersion, GameVersionLength);
+
+    auto &Summary = Request->Snapshot->Summary.Emplace();
+    Summary.bHasDetails = true;
+    Summary.PlayerName = FString(PlayerNameString.Length(), PlayerNameString.Get());
+    Summary.PlayTime = FTimespan::FromSeconds(PlayTimeSeconds);
+    Summary.Badges = Badges;
+    Summary.Timestamp = FDateTime(TimestampTicks);
+    Summary.GameVersion = FString(GameVersionString.Length(), GameVersionString.Get());
+}
+
+void USavePipelineExporter::AddPartyIcon(FPokeSharpSaveRequest *Request,
+                                         const UTF16CHAR *Species,
+                                         const int32 SpeciesLength,
+                                         const int32 Form,
+                                         const bool bShiny,
+                                         const bool bFemale,
+                                         const bool bEgg)
+{
+    check(Request->Snapshot->Summary.IsSet());
+    const auto SpeciesName = StringCast<TCHAR>(Species, SpeciesLength);
+    auto &Icon = Request->Snapshot->Summary->Party.Emplace_GetRef();
+    Icon.Species = FName(FStringView(SpeciesName.Get(), SpeciesName.Length()));
+    Icon.Form = Form;
+    Icon.bShiny = bShiny;
+    Icon.bFemale = bFemale;
+    Icon.bEgg = bEgg;
+}
+
+void USavePipelineExporter::Submit(FPokeSharpSaveRequest *Request,
+                                   const TCHAR *SlotName,
+                                   const bool bKeepUnwrittenSections)
+{
+    FPokeSharpSavePipeline::Get().Submit(
+        SlotName,
+        Request->Snapshot,
+        bKeepUnwrittenSections ? EPokeSharpSaveMode::Update : EPokeSharpSaveMode::Replace,
+        [Request](const float Progress)
+        {
+            // Sections finish on several workers at once, so never let a late report move the progress backwards
+            auto Current = Request->Progress.load();
+            while (Current < Progress && !Request->Progress.compare_exchange_weak(Current, Progress))
+            {
+            }
+
+            Request->ProgressDelegate.Invoke(nullptr, false);
+        },
+        [Request](const EPokeSharpSaveResult Result)
+        {
+            // The managed side only signals a task from here, the request stays alive until it calls Finish
+            Request->Result = Result;
+            Request->CompletionDelegate.Invoke(nullptr, false);
+        });
+}
+
+float USavePipelineExporter::GetProgress(const FPokeSharpSaveRequest *Request)
+{
+    return Request->Progress;
+}
+
+EPokeSharpSaveResult USavePipelineExporter::Finish(FPokeSharpSaveRequest *Request)
+{
+    const EPokeSharpSaveResult Result = Request->Result;
+    delete Request;
+    return Result;
+}
+
+bool USavePipelineExporter::OpenContainer(const TCHAR *SlotName, TSharedPtr<FPokeSharpSaveContainer> &OutContainer)
+{
+    FPokeSharpSavePipeline::Get().WaitForSlot(SlotName);
+    auto Container = FPokeSharpSaveContainer::Open(SlotName);
+
+    // The managed side hands us uninitialized memory, so the pointer has to be constructed in place
+    std::construct_at(&OutContainer, MoveTemp(Container));
+    return OutContainer.IsValid();
+}
+
+void USavePipelineExporter::ReleaseContainer(TSharedPtr<FPokeSharpSaveContainer> &Container)
+{
+    std::destroy_at(&Container);
+}
+
+int32 USavePipelineExporter::GetSectionCount(const FPokeSharpSaveContainer &Container)
+{
+    return Container.GetSections().Num();
+}
+
+void USavePipelineExporter::GetSectionInfo(const FPokeSharpSaveContainer &Container,
+                                           const int32 Index,
+                                           const TCHAR *&OutName,
+                                           int32 &OutNameLength,
+                                           int64 &OutSize)
+{
+    const auto &Entry = Container.GetSections()[Index];
+    OutName = *Entry.Name;
+    OutNameLength = Entry.Name.Len();
+    OutSize = Entry.UncompressedSize;
+}
+
+bool USavePipelineExporter::ReadSection(FPokeSharpSaveContainer &Container,
+                                        const UTF16CHAR *Name,
+                                        const int32 NameLength,
+                                        uint8 *Buffer,
+                                        const int64 BufferSize)
+{
+    POKESHARP_IO_SCOPE(SaveGame, Read, &Container);
+    const auto SectionName = StringCast<TCHAR>(Name, NameLength);
+    if (!Container.ReadSection(FStringView(SectionName.Get(), SectionName.Length()),
+                               TArrayView64<uint8>(Buffer, BufferSize)))
+    {
+        return false;
+    }
+
+    PokeSharpIOScope.Bytes = BufferSize;
+    return true;
+}
\ No newline at end of file
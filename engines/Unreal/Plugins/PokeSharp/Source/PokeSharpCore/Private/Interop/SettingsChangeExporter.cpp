@@ -14,4 +14,11 @@ void USettingsChangeExporter::RegisterSettingsChangeCallback(UDeveloperSettings
 void USettingsChangeExporter::UnregisterSettingsChangeCallback(const FGuid &Guid)
 {
     USettingsChangeManager::Get().Unbind(Guid);
-}
\ No newline at end of file
+}
+
+void USettingsChangeExporter::GetChangedProperties(const FName *&OutProperties, int32 &OutCount)
+{
+    const auto Properties = USettingsChangeManager::Get().GetChangedProperties();
+    OutProperties = Properties.GetData();
+    OutCount = Properties.Num();
+}
@@ -0,0 +1,16 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interop/SettingsSnapshotExporter.h"
+#include "Configuration/PokeSharpSettingsSnapshot.h"
+#include "Engine/DeveloperSettings.h"
+
+void USettingsSnapshotExporter::TakeSnapshot(const UDeveloperSettings *Settings, TArray<uint8> &OutBuffer)
+{
+    check(Settings != nullptr);
+    FPokeSharpSettingsSnapshot::Write(*Settings, OutBuffer);
+}
+
+void USettingsSnapshotExporter::ReleaseSnapshot(TArray<uint8> &Buffer)
+{
+    std::destroy_at(&Buffer);
+}
@@ -1,16 +1,30 @@
 ﻿#include "PokeSharpCore.h"
 #include "Configuration/SettingsChangeManager.h"
+#include "Data/PokeSharpDataPreloader.h"
+#include "Data/PokeSharpDataSettings.h"
+#include "Interop/PlatformFileExporter.h"
 #include "Modules/ModuleManager.h"
+#include "Saving/PokeSharpSavePipeline.h"
 
 #define LOCTEXT_NAMESPACE "FPokeSharpCoreModule"
 
 void FPokeSharpCoreModule::StartupModule()
 {
     USettingsChangeManager::Initialize();
+
+    // Kick off reading the data files now so that it overlaps with the rest of engine startup
+    const auto DataPath = FString::Printf(TEXT("/Game/%s"), *GetDefault<UPokeSharpDataSettings>()->DataPath.Path);
+    if (const auto Directory = UPlatformFileExporter::ConvertToContentDirPath(*DataPath); !Directory.IsEmpty())
+    {
+        FPokeSharpDataPreloader::Get().Start(Directory);
+    }
 }
 
 void FPokeSharpCoreModule::ShutdownModule()
 {
+    // Saves still being written have to land before the engine goes away
+    FPokeSharpSavePipeline::Get().Flush();
+    FPokeSharpDataPreloader::Get().Reset();
     USettingsChangeManager::Shutdown();
 }
 
@@ -0,0 +1,381 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Saving/PokeSharpSaveContainer.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "LogPokeSharpCore.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "PlatformFeatures.h"
+#include "Saving/PokeSharpSaveSlotIndex.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr int32 PlayerNameLength = 24;
+    constexpr int32 GameVersionLength = 24;
+    constexpr int32 SpeciesLength = 20;
+
+    constexpr uint8 PartyIconShiny = 1 << 0;
+    constexpr uint8 PartyIconFemale = 1 << 1;
+    constexpr uint8 PartyIconEgg = 1 << 2;
+
+    /**
+     * Checks whether a code unit continues a code point started by an earlier one, so a string must not be cut just
+     * before it.
+     */
+    template <typename CharType>
+    bool IsContinuationUnit(const CharType Unit)
+    {
+        if constexpr (sizeof(CharType) == 1)
+        {
+            return (static_cast<uint8>(Unit) & 0xC0) == 0x80;
+        }
+        else
+        {
+            return (static_cast<uint16>(Unit) & 0xFC00) == 0xDC00;
+        }
+    }
+
+    /**
+     * Writes a string into a zero-padded field of a fixed number of characters, truncating it if it does not fit.
+     * Truncation always happens on a code point boundary, so the field never ends in half a character.
+     */
+    template <typename CharType>
+    void WriteFixedString(FArchive &Ar, const FStringView Value, const int32 Capacity)
+    {
+        TArray<CharType, TInlineAllocator<32>> Buffer;
+        Buffer.SetNumZeroed(Capacity);
+        const auto Converted = StringCast<CharType>(Value.GetData(), Value.Len());
+        auto Length = FMath::Min(Converted.Length(), Capacity);
+        if (Length < Converted.Length())
+        {
+            while (Length > 0 && IsContinuationUnit(Converted.Get()[Length]))
+            {
+                Length--;
+            }
+        }
+
+        FMemory::Memcpy(Buffer.GetData(), Converted.Get(), Length * sizeof(CharType));
+        Ar.Serialize(Buffer.GetData(), Capacity * sizeof(CharType));
+    }
+
+    template <typename CharType>
+    FString ReadFixedString(FArchive &Ar, const int32 Capacity)
+    {
+        TArray<CharType, TInlineAllocator<32>> Buffer;
+        Buffer.SetNumUninitialized(Capacity);
+        Ar.Serialize(Buffer.GetData(), Capacity * sizeof(CharType));
+
+        int32 Length = 0;
+        while (Length < Capacity && Buffer[Length] != 0)
+        {
+            Length++;
+        }
+
+        const auto Converted = StringCast<TCHAR>(Buffer.GetData(), Length);
+        return FString(Converted.Length(), Converted.Get());
+    }
+} // namespace
+
+bool FPokeSharpSaveContainer::IsSupported()
+{
+    // The base implementation always hands out the generic save game system, platforms with their own override it
+    static const bool bSupported = []
+    {
+        auto &PlatformFeatures = IPlatformFeaturesModule::Get();
+        return PlatformFeatures.GetSaveGameSystem() == PlatformFeatures.IPlatformFeaturesModule::GetSaveGameSystem();
+    }();
+    return bSupported;
+}
+
+FString FPokeSharpSaveContainer::GetSlotPath(const FStringView SlotName)
+{
+    // Mirrors FGenericSaveGameSystem so that the engine's exists/delete checks keep working on containers
+    return FString::Printf(TEXT("%sSaveGames/%.*s.sav"), *FPaths::ProjectSavedDir(), SlotName.Len(), SlotName.GetData());
+}
+
+void FPokeSharpSaveContainer::WriteHeader(FArchive &Ar,
+                                          const int32 SectionCount,
+                                          int64 DirectoryOffset,
+                                          const TConstArrayView<uint8> Directory)
+{
+    auto FileMagic = Magic;
+    auto FileVersion = Version;
+    auto Count = static_cast<uint32>(SectionCount);
+    auto DirectorySize = static_cast<uint32>(Directory.Num());
+    auto DirectoryCrc = FCrc::MemCrc32(Directory.GetData(), Directory.Num());
+    uint32 Padding = 0;
+    Ar << FileMagic << FileVersion << Count << DirectorySize << DirectoryOffset << DirectoryCrc << Padding;
+}
+
+void FPokeSharpSaveContainer::WriteSummary(FArchive &Ar, const FPokeSharpSaveSlotSummary *Summary)
+{
+    const auto Start = Ar.Tell();
+    uint8 bHasSummary = Summary != nullptr;
+    uint8 PartyCount = Summary != nullptr ? FMath::Min(Summary->Party.Num(), MaxPartySize) : 0;
+    uint8 Padding[6] = {};
+    Ar << bHasSummary << PartyCount;
+    Ar.Serialize(Padding, sizeof(Padding));
+
+    if (Summary != nullptr)
+    {
+        auto Timestamp = Summary->Timestamp.GetTicks();
+        auto PlayTime = Summary->PlayTime.GetTotalSeconds();
+        auto Badges = static_cast<uint64>(Summary->Badges);
+        Ar << Timestamp << PlayTime << Badges;
+        WriteFixedString<UTF16CHAR>(Ar, Summary->PlayerName, PlayerNameLength);
+        WriteFixedString<UTF8CHAR>(Ar, Summary->GameVersion, GameVersionLength);
+
+        for (int32 i = 0; i < PartyCount; i++)
+        {
+            const auto &Icon = Summary->Party[i];
+            WriteFixedString<UTF8CHAR>(Ar, Icon.Species.ToString(), SpeciesLength);
+
+            auto Form = static_cast<uint8>(Icon.Form);
+            uint8 Flags = (Icon.bShiny ? PartyIconShiny : 0) | (Icon.bFemale ? PartyIconFemale : 0) |
+                          (Icon.bEgg ? PartyIconEgg : 0);
+            uint16 IconPadding = 0;
+            Ar << Form << Flags << IconPadding;
+        }
+    }
+
+    // Whatever is left of the block stays zeroed, so the sections always start at the same offset
+    TArray<uint8, TInlineAllocator<SummarySize>> Remaining;
+    Remaining.SetNumZeroed(static_cast<int32>(SummarySize - (Ar.Tell() - Start)));
+    Ar.Serialize(Remaining.GetData(), Remaining.Num());
+}
+
+bool FPokeSharpSaveContainer::ReadSummary(IFileHandle &Handle, FPokeSharpSaveSlotSummary &OutSummary)
+{
+    uint8 Block[DataOffset];
+    if (!Handle.Seek(0) || !Handle.Read(Block, DataOffset))
+    {
+        return false;
+    }
+
+    uint32 FileMagic;
+    uint32 FileVersion;
+    FMemoryReaderView Reader(MakeArrayView(Block));
+    Reader << FileMagic << FileVersion;
+    if (FileMagic != Magic || FileVersion != Version)
+    {
+        return false;
+    }
+
+    uint8 bHasSummary;
+    uint8 PartyCount;
+    uint8 Padding[6];
+    Reader.Seek(HeaderSize);
+    Reader << bHasSummary << PartyCount;
+    Reader.Serialize(Padding, sizeof(Padding));
+    if (!bHasSummary)
+    {
+        return false;
+    }
+
+    int64 Timestamp;
+    double PlayTime;
+    uint64 Badges;
+    Reader << Timestamp << PlayTime << Badges;
+    OutSummary.bHasDetails = true;
+    OutSummary.Timestamp = FDateTime(Timestamp);
+    OutSummary.PlayTime = FTimespan::FromSeconds(PlayTime);
+    OutSummary.Badges = static_cast<int64>(Badges);
+    OutSummary.PlayerName = ReadFixedString<UTF16CHAR>(Reader, PlayerNameLength);
+    OutSummary.GameVersion = ReadFixedString<UTF8CHAR>(Reader, GameVersionLength);
+
+    OutSummary.Party.Reset(PartyCount);
+    for (int32 i = 0; i < FMath::Min<int32>(PartyCount, MaxPartySize); i++)
+    {
+        auto &Icon = OutSummary.Party.Emplace_GetRef();
+        Icon.Species = FName(ReadFixedString<UTF8CHAR>(Reader, SpeciesLength));
+
+        uint8 Form;
+        uint8 Flags;
+        uint16 IconPadding;
+        Reader << Form << Flags << IconPadding;
+        Icon.Form = Form;
+        Icon.bShiny = (Flags & PartyIconShiny) != 0;
+        Icon.bFemale = (Flags & PartyIconFemale) != 0;
+        Icon.bEgg = (Flags & PartyIconEgg) != 0;
+    }
+
+    return !Reader.IsError();
+}
+
+TArray<uint8> FPokeSharpSaveContainer::WriteDirectory(const TConstArrayView<FPokeSharpSaveSectionEntry> Entries)
+{
+    TArray<uint8> Directory;
+    FMemoryWriter Writer(Directory);
+    for (const auto &Entry : Entries)
+    {
+        const auto Name = StringCast<UTF8CHAR>(*Entry.Name, Entry.Name.Len());
+        auto NameLength = static_cast<uint16>(Name.Length());
+        Writer << NameLength;
+        Writer.Serialize(const_cast<UTF8CHAR *>(Name.Get()), NameLength);
+
+        auto Compression = static_cast<uint8>(Entry.Compression);
+        auto Offset = Entry.Offset;
+        auto Size = Entry.Size;
+        auto UncompressedSize = Entry.UncompressedSize;
+        auto Crc = Entry.Crc;
+        auto Hash = Entry.Hash;
+        Writer << Compression << Offset << Size << UncompressedSize << Crc << Hash;
+    }
+
+    return Directory;
+}
+
+uint64 FPokeSharpSaveContainer::HashSection(const TConstArrayView64<uint8> Data)
+{
+    return CityHash64(reinterpret_cast<const char *>(Data.GetData()), static_cast<uint32>(Data.Num()));
+}
+
+bool FPokeSharpSaveContainer::ReadDirectory(IFileHandle &Handle, TArray<FPokeSharpSaveSectionEntry> &OutSections)
+{
+    const auto FileSize = Handle.Size();
+    uint8 Header[HeaderSize];
+    if (FileSize < HeaderSize || !Handle.Seek(0) || !Handle.Read(Header, HeaderSize))
+    {
+        return false;
+    }
+
+    uint32 FileMagic;
+    uint32 FileVersion;
+    uint32 SectionCount;
+    uint32 DirectorySize;
+    int64 DirectoryOffset;
+    uint32 DirectoryCrc;
+    FMemoryReaderView HeaderReader(MakeArrayView(Header));
+    HeaderReader << FileMagic << FileVersion << SectionCount << DirectorySize << DirectoryOffset << DirectoryCrc;
+    if (FileMagic != Magic || FileVersion != Version || DirectoryOffset < DataOffset ||
+        DirectoryOffset + DirectorySize > FileSize)
+    {
+        return false;
+    }
+
+    TArray<uint8> Directory;
+    Directory.SetNumUninitialized(DirectorySize);
+    if (!Handle.Seek(DirectoryOffset) || !Handle.Read(Directory.GetData(), DirectorySize) ||
+        FCrc::MemCrc32(Directory.GetData(), DirectorySize) != DirectoryCrc)
+    {
+        return false;
+    }
+
+    FMemoryReader DirectoryReader(Directory);
+    OutSections.Reset(SectionCount);
+    for (uint32 i = 0; i < SectionCount; i++)
+    {
+        uint16 NameLength;
+        DirectoryReader << NameLength;
+
+        TArray<uint8, TInlineAllocator<64>> NameBuffer;
+        NameBuffer.SetNumUninitialized(NameLength);
+        DirectoryReader.Serialize(NameBuffer.GetData(), NameLength);
+
+        auto &Entry = OutSections.Emplace_GetRef();
+        uint8 Compression;
+        DirectoryReader << Compression << Entry.Offset << Entry.Size << Entry.UncompressedSize << Entry.Crc
+                        << Entry.Hash;
+        Entry.Compression = static_cast<EPokeSharpDataCompression>(Compression);
+        if (DirectoryReader.IsError() || Entry.Offset < DataOffset || Entry.Size < 0 ||
+            Entry.Offset + Entry.Size > FileSize)
+        {
+            return false;
+        }
+
+        const FUTF8ToTCHAR Name(reinterpret_cast<const UTF8CHAR *>(NameBuffer.GetData()), NameLength);
+        Entry.Name = FString(Name.Length(), Name.Get());
+    }
+
+    return true;
+}
+
+FPokeSharpSaveContainer::~FPokeSharpSaveContainer() = default;
+
+TSharedPtr<FPokeSharpSaveContainer> FPokeSharpSaveContainer::Open(const FStringView SlotName)
+{
+    if (!IsSupported())
+    {
+        return nullptr;
+    }
+
+    auto Container = MakeShared<FPokeSharpSaveContainer>();
+    Container->SlotPath = GetSlotPath(SlotName);
+
+    // Other readers and the save pipeline's appends have to be able to share the file while the container is open
+    Container->Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Container->SlotPath, true));
+    if (Container->Handle == nullptr)
+    {
+        return nullptr;
+    }
+
+    uint32 FileMagic = 0;
+    if (!Container->Handle->Read(reinterpret_cast<uint8 *>(&FileMagic), sizeof(FileMagic)) || FileMagic != Magic)
+    {
+        // Most likely a save written through the USaveGame path
+        return nullptr;
+    }
+
+    if (!ReadDirectory(*Container->Handle, Container->Sections))
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("%s is not a valid save container"), *Container->SlotPath);
+        return nullptr;
+    }
+
+    return Container;
+}
+
+const FPokeSharpSaveSectionEntry *FPokeSharpSaveContainer::FindSection(const FStringView Name) const
+{
+    return Sections.FindByPredicate([Name](const FPokeSharpSaveSectionEntry &Entry) { return Entry.Name == Name; });
+}
+
+bool FPokeSharpSaveContainer::ReadSection(const FStringView Name, const TArrayView64<uint8> Destination)
+{
+    const auto *Entry = FindSection(Name);
+    if (Entry == nullptr || Destination.Num() < Entry->UncompressedSize)
+    {
+        return false;
+    }
+
+    // Stored sections can go straight into the destination, only compressed ones need somewhere to inflate from
+    TArray64<uint8> Compressed;
+    auto Stored = Destination.Left(Entry->Size);
+    if (Entry->Compression != EPokeSharpDataCompression::None)
+    {
+        Compressed.SetNumUninitialized(Entry->Size);
+        Stored = Compressed;
+    }
+
+    {
+        FScopeLock Lock(&HandleLock);
+        if (!Handle->Seek(Entry->Offset) || !Handle->Read(Stored.GetData(), Stored.Num()))
+        {
+            UE_LOG(LogPokeSharpCore, Error, TEXT("Failed to read save section %s from %s"), *Entry->Name, *SlotPath);
+            return false;
+        }
+    }
+
+    if (FCrc::MemCrc32(Stored.GetData(), static_cast<int32>(Stored.Num())) != Entry->Crc)
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Save section %s in %s failed its checksum"), *Entry->Name, *SlotPath);
+        return false;
+    }
+
+    if (Entry->Compression == EPokeSharpDataCompression::None)
+    {
+        return true;
+    }
+
+    return FCompression::UncompressMemory(NAME_Zlib,
+                                          Destination.GetData(),
+                                          Entry->UncompressedSize,
+                                          Stored.GetData(),
+                                          Stored.Num());
+}
\ No newline at end of file
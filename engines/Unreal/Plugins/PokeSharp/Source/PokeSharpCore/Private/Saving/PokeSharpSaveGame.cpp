@@ -1,14 +1,146 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Saving/PokeSharpSaveGame.h"
+#include "Data/PokeSharpDataArchive.h"
+#include "LogPokeSharpCore.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
 #include "Saving/PokeSharpSaveSettings.h"
+#include "Serialization/CustomVersion.h"
 #include "UObject/Package.h"
 
+namespace
+{
+    struct FPokeSharpSaveGameVersion
+    {
+        enum Type : int32
+        {
+            BeforeCustomVersionWasAdded = 0,
+
+            // The data is stored compressed after the tagged properties, with a checksum trailer
+            CompressedData,
+
+            VersionPlusOne,
+            LatestVersion = VersionPlusOne - 1
+        };
+
+        static constexpr FGuid Guid = FGuid(0x6D2B8F41, 0x3C9A4E57, 0xA1E04B8D, 0x92F7C316);
+    };
+
+    const FCustomVersionRegistration GRegisterPokeSharpSaveGameVersion(FPokeSharpSaveGameVersion::Guid,
+                                                                       FPokeSharpSaveGameVersion::LatestVersion,
+                                                                       TEXT("PokeSharpSaveGame"));
+} // namespace
+
 UPokeSharpSaveGame *UPokeSharpSaveGame::CreateSaveGame()
 {
     return NewObject<UPokeSharpSaveGame>(GetTransientPackage(), GetDefault<UPokeSharpSaveSettings>()->SaveGameClass);
 }
 
+void UPokeSharpSaveGame::Serialize(FArchive &Ar)
+{
+    Ar.UsingCustomVersion(FPokeSharpSaveGameVersion::Guid);
+
+    // Only the archives that actually persist the save get the compressed form, reference collectors and the like
+    // just see the plain property
+    const bool bCompressedData =
+        Ar.IsPersistent() && !Ar.IsObjectReferenceCollector() &&
+        (Ar.IsSaving() || Ar.CustomVer(FPokeSharpSaveGameVersion::Guid) >= FPokeSharpSaveGameVersion::CompressedData);
+    if (!bCompressedData)
+    {
+        Super::Serialize(Ar);
+        return;
+    }
+
+    if (Ar.IsSaving())
+    {
+        // The data follows the tagged properties, so keep it out of them while they are written
+        auto Uncompressed = MoveTemp(Data);
+        Super::Serialize(Ar);
+        Data = MoveTemp(Uncompressed);
+        WriteCompressedData(Ar);
+    }
+    else
+    {
+        Super::Serialize(Ar);
+        ReadCompressedData(Ar);
+    }
+}
+
+void UPokeSharpSaveGame::WriteCompressedData(FArchive &Ar) const
+{
+    auto UncompressedSize = Data.Num();
+    auto CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(CompressedSize);
+
+    auto Compression = static_cast<uint8>(EPokeSharpDataCompression::Zlib);
+    if (!FCompression::CompressMemory(NAME_Zlib,
+                                      Compressed.GetData(),
+                                      CompressedSize,
+                                      Data.GetData(),
+                                      UncompressedSize) ||
+        CompressedSize >= UncompressedSize)
+    {
+        // Data that does not shrink is stored as it is
+        Compression = static_cast<uint8>(EPokeSharpDataCompression::None);
+        CompressedSize = UncompressedSize;
+    }
+
+    const auto &Stored = Compression == static_cast<uint8>(EPokeSharpDataCompression::None) ? Data : Compressed;
+    auto Crc = FCrc::MemCrc32(Data.GetData(), UncompressedSize);
+    Ar << Compression << UncompressedSize << CompressedSize;
+    Ar.Serialize(const_cast<uint8 *>(Stored.GetData()), CompressedSize);
+    Ar << Crc;
+}
+
+void UPokeSharpSaveGame::ReadCompressedData(FArchive &Ar)
+{
+    uint8 Compression = 0;
+    int32 UncompressedSize = 0;
+    int32 StoredSize = 0;
+    Ar << Compression << UncompressedSize << StoredSize;
+
+    // Bail out before allocating anything if the sizes are clearly not from an intact save
+    const auto TotalSize = Ar.TotalSize();
+    bCorrupt = Ar.IsError() || UncompressedSize < 0 || StoredSize < 0 ||
+               (TotalSize > 0 && StoredSize > TotalSize - Ar.Tell()) ||
+               Compression > static_cast<uint8>(EPokeSharpDataCompression::Zlib);
+
+    if (!bCorrupt)
+    {
+        TArray<uint8> Stored;
+        Stored.SetNumUninitialized(StoredSize);
+        Ar.Serialize(Stored.GetData(), StoredSize);
+
+        uint32 Crc = 0;
+        Ar << Crc;
+
+        if (Compression == static_cast<uint8>(EPokeSharpDataCompression::None))
+        {
+            Data = MoveTemp(Stored);
+            bCorrupt = Ar.IsError() || UncompressedSize != StoredSize;
+        }
+        else
+        {
+            Data.SetNumUninitialized(UncompressedSize);
+            bCorrupt = Ar.IsError() || !FCompression::UncompressMemory(NAME_Zlib,
+                                                                        Data.GetData(),
+                                                                        UncompressedSize,
+                                                                        Stored.GetData(),
+                                                                        StoredSize);
+        }
+
+        bCorrupt = bCorrupt || FCrc::MemCrc32(Data.GetData(), Data.Num()) != Crc;
+    }
+
+    if (bCorrupt)
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Save data failed its integrity check"));
+        Data.Empty();
+    }
+}
+
 void UPokeSharpSaveGame::SetDataLength(const int32 NewLength)
 {
     Data.SetNumZeroed(NewLength);
@@ -17,4 +149,32 @@ void UPokeSharpSaveGame::SetDataLength(const int32 NewLength)
 void UPokeSharpSaveGame::WriteData(const TConstArrayView<uint8> Buffer)
 {
     Data.Append(Buffer.GetData(), Buffer.Num());
+}
+
+void UPokeSharpSaveGame::ReserveData(const int32 Capacity)
+{
+    Data.Reserve(Capacity);
+}
+
+TArrayView<uint8> UPokeSharpSaveGame::GetWriteSpan(const int32 MinSize)
+{
+    if (Data.GetSlack() < MinSize)
+    {
+        // Grow geometrically so that a long run of small writes only reallocates a handful of times
+        Data.Reserve(FMath::Max(Data.Num() + MinSize, Data.Max() * 2));
+    }
+
+    return TArrayView<uint8>(Data.GetData() + Data.Num(), Data.GetSlack());
+}
+
+bool UPokeSharpSaveGame::CommitData(const int32 Bytes)
+{
+    if (Bytes < 0 || Bytes > Data.GetSlack())
+    {
+        return false;
+    }
+
+    // The bytes are already in place in the slack, so growing the array must not touch them
+    Data.AddUninitialized(Bytes);
+    return true;
 }
\ No newline at end of file
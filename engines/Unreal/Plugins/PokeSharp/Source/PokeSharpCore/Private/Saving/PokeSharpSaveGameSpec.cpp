@@ -0,0 +1,511 @@
+﻿#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformTime.h"
+#include "Interop/PokeSharpSaveGameExporter.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Saving/PokeSharpSaveContainer.h"
+#include "Saving/PokeSharpSaveGame.h"
+#include "Saving/PokeSharpSavePipeline.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+    /**
+     * A synthetic save, sized after a given amount of stored Pokémon and bag items.
+     */
+    struct FSaveBenchmarkCase
+    {
+        const TCHAR *Name;
+        int32 PokemonCount;
+        int32 ItemCount;
+    };
+
+    constexpr FSaveBenchmarkCase BenchmarkCases[] = {
+        {TEXT("Party"), 6, 0},
+        {TEXT("EightBoxes"), 6 + 8 * 30, 200},
+        {TEXT("FullStorage"), 6 + 30 * 30, 800},
+    };
+
+    constexpr int32 SyncIterations = 5;
+    constexpr int32 StreamChunkSize = 4096;
+    constexpr int32 SnapshotSectionCount = 8;
+
+    struct FBenchmarkSample
+    {
+        double LatencyMs = 0.0;
+
+        /**
+         * How much the memory tracked by LLM grew while the sample was taken, which can be negative if more was freed
+         * than allocated. Unset unless the process runs with -LLM.
+         */
+        TOptional<int64> NetAllocatedBytes;
+    };
+
+    /**
+     * Times a block of work and measures how much tracked memory it allocates. The numbers come from LLM's total for
+     * the whole process, so they cover the worker threads the async paths run on, along with anything else the process
+     * does in the meantime. No allocator exposes how many allocations were made, so the report leaves those out.
+     */
+    class FBenchmarkScope
+    {
+      public:
+        FBenchmarkScope() : StartTrackedBytes(GetTrackedBytes()), StartTime(FPlatformTime::Seconds())
+        {
+        }
+
+        FBenchmarkSample Stop()
+        {
+            if (!bStopped)
+            {
+                Sample.LatencyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+                if (const auto EndTrackedBytes = GetTrackedBytes(); EndTrackedBytes && StartTrackedBytes)
+                {
+                    Sample.NetAllocatedBytes = *EndTrackedBytes - *StartTrackedBytes;
+                }
+
+                bStopped = true;
+            }
+
+            return Sample;
+        }
+
+      private:
+        static TOptional<int64> GetTrackedBytes()
+        {
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+            if (FLowLevelMemTracker::IsEnabled())
+            {
+                return static_cast<int64>(FLowLevelMemTracker::Get().GetTotalTrackedMemory(ELLMTracker::Default));
+            }
+#endif
+            return {};
+        }
+
+        TOptional<int64> StartTrackedBytes;
+        double StartTime;
+        FBenchmarkSample Sample;
+        bool bStopped = false;
+    };
+
+    /**
+     * Builds a payload shaped like the managed MessagePack output: one map per Pokémon with the same keys every time
+     * and a mix of small integers and short strings as values, followed by the bag as a map of item names to counts.
+     */
+    TArray<uint8> BuildSyntheticSave(const FSaveBenchmarkCase &Case)
+    {
+        static const ANSICHAR *PokemonKeys[] = {"Species",   "Form",    "Level", "Exp",     "Nature", "Ability",
+                                                "Item",      "Moves",   "IVs",   "EVs",     "Happy",  "Nickname",
+                                                "OwnerName", "OwnerId", "Ball",  "Ribbons", "Shiny",  "Gender"};
+
+        TArray<uint8> Data;
+        FRandomStream Random(Case.PokemonCount * 31 + Case.ItemCount);
+        const auto WriteString = [&Data](const FAnsiStringView Value)
+        {
+            Data.Add(static_cast<uint8>(0xA0 | Value.Len()));
+            Data.Append(reinterpret_cast<const uint8 *>(Value.GetData()), Value.Len());
+        };
+        const auto WriteRandomString = [&](const int32 Length)
+        {
+            Data.Add(static_cast<uint8>(0xA0 | Length));
+            for (int32 i = 0; i < Length; i++)
+            {
+                Data.Add(static_cast<uint8>(Random.RandRange('A', 'Z')));
+            }
+        };
+        const auto WriteInteger = [&Data](const uint32 Value)
+        {
+            if (Value < 0x80)
+            {
+                Data.Add(static_cast<uint8>(Value));
+                return;
+            }
+
+            Data.Add(0xCE);
+            Data.Append({static_cast<uint8>(Value >> 24),
+                         static_cast<uint8>(Value >> 16),
+                         static_cast<uint8>(Value >> 8),
+                         static_cast<uint8>(Value)});
+        };
+
+        Data.Add(0xDD);
+        Data.Append({0, 0, static_cast<uint8>(Case.PokemonCount >> 8), static_cast<uint8>(Case.PokemonCount)});
+        for (int32 i = 0; i < Case.PokemonCount; i++)
+        {
+            Data.Append({0xDE, 0, static_cast<uint8>(UE_ARRAY_COUNT(PokemonKeys))});
+            for (const auto *Key : PokemonKeys)
+            {
+                WriteString(Key);
+                if (Random.FRand() < 0.25f)
+                {
+                    WriteRandomString(Random.RandRange(4, 12));
+                }
+                else
+                {
+                    WriteInteger(Random.RandRange(0, 1) == 0 ? Random.RandRange(0, 100) : Random.GetUnsignedInt());
+                }
+            }
+        }
+
+        Data.Add(0xDF);
+        Data.Append({0, 0, static_cast<uint8>(Case.ItemCount >> 8), static_cast<uint8>(Case.ItemCount)});
+        for (int32 i = 0; i < Case.ItemCount; i++)
+        {
+            WriteRandomString(Random.RandRange(6, 14));
+            WriteInteger(Random.RandRange(1, 99));
+        }
+
+        return Data;
+    }
+
+    FString GetSlotName(const FSaveBenchmarkCase &Case)
+    {
+        return FString::Printf(TEXT("PokeSharpSaveBenchmark_%s"), Case.Name);
+    }
+
+    /**
+     * Splits a payload into evenly sized sections, standing in for the separately serialized save values.
+     */
+    TSharedRef<FPokeSharpSaveSnapshot> BuildSnapshot(const TConstArrayView<uint8> Payload)
+    {
+        auto Snapshot = MakeShared<FPokeSharpSaveSnapshot>();
+        const auto SectionSize = FMath::DivideAndRoundUp(Payload.Num(), SnapshotSectionCount);
+        for (int32 i = 0; i < SnapshotSectionCount; i++)
+        {
+            const auto Offset = FMath::Min(i * SectionSize, Payload.Num());
+            Snapshot->AddSection(FString::Printf(TEXT("Section%d"), i),
+                                 Payload.Mid(Offset, FMath::Min(SectionSize, Payload.Num() - Offset)));
+        }
+
+        return Snapshot;
+    }
+
+    FString GetReportPath()
+    {
+        FString ReportPath;
+        if (!FParse::Value(FCommandLine::Get(), TEXT("PokeSharpSaveBenchmarkReport="), ReportPath))
+        {
+            ReportPath = FPaths::Combine(FPaths::AutomationDir(), TEXT("PokeSharpSaveBenchmark.json"));
+        }
+
+        return ReportPath;
+    }
+
+    TSharedPtr<FJsonObject> LoadBaseline()
+    {
+        FString BaselinePath;
+        FString BaselineJson;
+        TSharedPtr<FJsonObject> Baseline;
+        if (FParse::Value(FCommandLine::Get(), TEXT("PokeSharpSaveBenchmarkBaseline="), BaselinePath) &&
+            FFileHelper::LoadFileToString(BaselineJson, *BaselinePath))
+        {
+            FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline);
+        }
+
+        return Baseline;
+    }
+} // namespace
+
+BEGIN_DEFINE_SPEC(FPokeSharpSaveGameSpec,
+                  "PokeSharp.Saving.Performance",
+                  EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+TSharedPtr<FJsonObject> Baseline;
+TArray<uint8> Payload;
+TStrongObjectPtr<UPokeSharpSaveGame> SaveGame;
+
+/**
+ * Adds a sample to the report, which is rewritten after every sample so a crash part way through still leaves the
+ * earlier results behind. When a baseline is given, samples that are slower than it by more than the tolerance fail.
+ */
+void RecordSample(const FSaveBenchmarkCase &Case, const TCHAR *Path, const FBenchmarkSample &Sample)
+{
+    auto Cases = Report->GetObjectField(TEXT("Cases"));
+    const TSharedPtr<FJsonObject> *CaseObject;
+    if (!Cases->TryGetObjectField(Case.Name, CaseObject))
+    {
+        auto NewCase = MakeShared<FJsonObject>();
+        NewCase->SetNumberField(TEXT("PayloadBytes"), Payload.Num());
+        NewCase->SetObjectField(TEXT("Paths"), MakeShared<FJsonObject>());
+        Cases->SetObjectField(Case.Name, NewCase);
+        Cases->TryGetObjectField(Case.Name, CaseObject);
+    }
+
+    // Measurements that are not available are written as null, so a missing number is never mistaken for a zero
+    auto SampleObject = MakeShared<FJsonObject>();
+    SampleObject->SetNumberField(TEXT("LatencyMs"), Sample.LatencyMs);
+    SampleObject->SetField(TEXT("Allocations"), MakeShared<FJsonValueNull>());
+    if (Sample.NetAllocatedBytes.IsSet())
+    {
+        SampleObject->SetNumberField(TEXT("NetAllocatedBytes"), static_cast<double>(*Sample.NetAllocatedBytes));
+    }
+    else
+    {
+        SampleObject->SetField(TEXT("NetAllocatedBytes"), MakeShared<FJsonValueNull>());
+    }
+    (*CaseObject)->GetObjectField(TEXT("Paths"))->SetObjectField(Path, SampleObject);
+
+    FString Json;
+    FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&Json));
+    TestTrue(TEXT("The benchmark report was written"), FFileHelper::SaveStringToFile(Json, *GetReportPath()));
+
+    const TSharedPtr<FJsonObject> *BaselineCases;
+    const TSharedPtr<FJsonObject> *BaselineCase;
+    const TSharedPtr<FJsonObject> *BaselinePaths;
+    const TSharedPtr<FJsonObject> *BaselineSample;
+    if (Baseline == nullptr || !Baseline->TryGetObjectField(TEXT("Cases"), BaselineCases) ||
+        !(*BaselineCases)->TryGetObjectField(Case.Name, BaselineCase) ||
+        !(*BaselineCase)->TryGetObjectField(TEXT("Paths"), BaselinePaths) ||
+        !(*BaselinePaths)->TryGetObjectField(Path, BaselineSample))
+    {
+        return;
+    }
+
+    float Tolerance = 0.25f;
+    FParse::Value(FCommandLine::Get(), TEXT("PokeSharpSaveBenchmarkTolerance="), Tolerance);
+    const auto BaselineLatency = (*BaselineSample)->GetNumberField(TEXT("LatencyMs"));
+    if (Sample.LatencyMs > BaselineLatency * (1.0 + Tolerance))
+    {
+        AddError(FString::Printf(TEXT("%s/%s took %.2fms, the baseline is %.2fms"),
+                                 Case.Name,
+                                 Path,
+                                 Sample.LatencyMs,
+                                 BaselineLatency));
+    }
+}
+
+/**
+ * Runs a synchronous path several times and records the median run.
+ */
+template <typename FunctorType>
+void MeasureSync(const FSaveBenchmarkCase &Case, const TCHAR *Path, FunctorType &&Functor)
+{
+    TArray<FBenchmarkSample> Samples;
+    for (int32 i = 0; i < SyncIterations; i++)
+    {
+        auto *Target = UPokeSharpSaveGame::CreateSaveGame();
+        FBenchmarkScope Scope;
+        Functor(Target);
+        Samples.Add(Scope.Stop());
+        TestEqual(TEXT("The whole payload was written"), Target->GetDataSize(), Payload.Num());
+    }
+
+    Samples.Sort([](const FBenchmarkSample &A, const FBenchmarkSample &B) { return A.LatencyMs < B.LatencyMs; });
+    RecordSample(Case, Path, Samples[SyncIterations / 2]);
+}
+
+/**
+ * Submits a snapshot to the save pipeline and records how long it takes to be written. The pipeline completes on a
+ * worker thread, so the result is handed back to the game thread before it is recorded.
+ */
+void MeasurePipeline(const FSaveBenchmarkCase &Case,
+                     const TCHAR *Path,
+                     TSharedRef<const FPokeSharpSaveSnapshot> Snapshot,
+                     EPokeSharpSaveMode Mode,
+                     const FDoneDelegate &Done)
+{
+    auto Scope = MakeShared<FBenchmarkScope>();
+    FPokeSharpSavePipeline::Get().Submit(
+        GetSlotName(Case),
+        MoveTemp(Snapshot),
+        Mode,
+        nullptr,
+        [this, &Case, Path, Done, Scope](const EPokeSharpSaveResult Result)
+        {
+            const auto Sample = Scope->Stop();
+            AsyncTask(ENamedThreads::GameThread,
+                      [this, &Case, Path, Done, Sample, Result]
+                      {
+                          RecordSample(Case, Path, Sample);
+                          TestTrue(TEXT("The save was written"), Result == EPokeSharpSaveResult::Succeeded);
+                          UGameplayStatics::DeleteGameInSlot(GetSlotName(Case), 0);
+                          Done.Execute();
+                      });
+        });
+}
+
+void DefineCase(const FSaveBenchmarkCase &Case);
+END_DEFINE_SPEC(FPokeSharpSaveGameSpec)
+
+void FPokeSharpSaveGameSpec::Define()
+{
+    Report->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+    Report->SetObjectField(TEXT("Cases"), MakeShared<FJsonObject>());
+    Baseline = LoadBaseline();
+
+    for (const auto &Case : BenchmarkCases)
+    {
+        DefineCase(Case);
+    }
+}
+
+void FPokeSharpSaveGameSpec::DefineCase(const FSaveBenchmarkCase &Case)
+{
+    Describe(
+        Case.Name,
+        [this, &Case]
+        {
+            BeforeEach(
+                [this, &Case]
+                {
+                    Payload = BuildSyntheticSave(Case);
+                    SaveGame.Reset(UPokeSharpSaveGame::CreateSaveGame());
+                    SaveGame->WriteData(Payload);
+                });
+
+            AfterEach(
+                [this]
+                {
+                    SaveGame.Reset();
+                });
+
+            It("should measure writing the data in stream-sized chunks",
+               [this, &Case]
+               {
+                   MeasureSync(Case,
+                               TEXT("WriteData"),
+                               [this](UPokeSharpSaveGame *Target)
+                               {
+                                   for (int32 Offset = 0; Offset < Payload.Num(); Offset += StreamChunkSize)
+                                   {
+                                       Target->WriteData(TConstArrayView<uint8>(Payload).Mid(Offset, StreamChunkSize));
+                                   }
+                               });
+               });
+
+            It("should measure writing the data through the exporter",
+               [this, &Case]
+               {
+                   MeasureSync(Case,
+                               TEXT("Exporter"),
+                               [this](UPokeSharpSaveGame *Target)
+                               {
+                                   UPokeSharpSaveGameExporter::ReserveDataBuffer(Target, Payload.Num());
+                                   for (int32 Offset = 0; Offset < Payload.Num(); Offset += StreamChunkSize)
+                                   {
+                                       uint8 *Buffer;
+                                       int32 Size;
+                                       const auto Chunk = FMath::Min(StreamChunkSize, Payload.Num() - Offset);
+                                       UPokeSharpSaveGameExporter::GetWriteSpan(Target, Chunk, Buffer, Size);
+                                       FMemory::Memcpy(Buffer, Payload.GetData() + Offset, Chunk);
+                                       UPokeSharpSaveGameExporter::CommitWrite(Target, Chunk);
+                                   }
+
+                                   const uint8 *ReadBuffer;
+                                   int32 ReadSize;
+                                   UPokeSharpSaveGameExporter::GetDataReadBuffer(Target, ReadBuffer, ReadSize);
+                               });
+               });
+
+            // USaveGameToSlotAsync and ULoadGameFromSlotAsync only forward to these and hand the result to managed
+            // code, which is not running here. The callbacks own their scope, since they may still arrive after the
+            // latent timeout has moved on to the next test.
+            LatentIt("should measure saving to a slot asynchronously",
+                     [this, &Case](const FDoneDelegate &Done)
+                     {
+                         auto Scope = MakeShared<FBenchmarkScope>();
+                         UGameplayStatics::AsyncSaveGameToSlot(
+                             SaveGame.Get(),
+                             GetSlotName(Case),
+                             0,
+                             FAsyncSaveGameToSlotDelegate::CreateLambda(
+                                 [this, &Case, Done, Scope](const FString &SlotName, int32, const bool bSucceeded)
+                                 {
+                                     RecordSample(Case, TEXT("SaveGameToSlotAsync"), Scope->Stop());
+                                     TestTrue(TEXT("The save was written"), bSucceeded);
+                                     UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+                                     Done.Execute();
+                                 }));
+                     });
+
+            LatentIt("should measure writing a snapshot through the save pipeline",
+                     [this, &Case](const FDoneDelegate &Done)
+                     {
+                         if (!FPokeSharpSaveContainer::IsSupported())
+                         {
+                             AddInfo(TEXT("Save containers are not supported on this platform"));
+                             Done.Execute();
+                             return;
+                         }
+
+                         MeasurePipeline(Case,
+                                         TEXT("SavePipeline"),
+                                         BuildSnapshot(Payload),
+                                         EPokeSharpSaveMode::Replace,
+                                         Done);
+                     });
+
+            LatentIt("should measure updating a single section through the save pipeline",
+                     [this, &Case](const FDoneDelegate &Done)
+                     {
+                         if (!FPokeSharpSaveContainer::IsSupported())
+                         {
+                             AddInfo(TEXT("Save containers are not supported on this platform"));
+                             Done.Execute();
+                             return;
+                         }
+
+                         // The full save is written first, untimed, so the update has a container to append to
+                         auto &Pipeline = FPokeSharpSavePipeline::Get();
+                         Pipeline.Submit(GetSlotName(Case),
+                                         BuildSnapshot(Payload),
+                                         EPokeSharpSaveMode::Replace,
+                                         nullptr,
+                                         [](EPokeSharpSaveResult) {});
+                         Pipeline.WaitForSlot(GetSlotName(Case));
+
+                         auto Changed = BuildSnapshot(Payload);
+                         Changed->Sections.SetNum(1);
+                         Changed->Sections[0].Data[0] ^= 0xFF;
+                         MeasurePipeline(Case,
+                                         TEXT("SavePipelineUpdate"),
+                                         MoveTemp(Changed),
+                                         EPokeSharpSaveMode::Update,
+                                         Done);
+                     });
+
+            LatentIt("should measure loading from a slot asynchronously",
+                     [this, &Case](const FDoneDelegate &Done)
+                     {
+                         if (!UGameplayStatics::SaveGameToSlot(SaveGame.Get(), GetSlotName(Case), 0))
+                         {
+                             AddError(TEXT("Failed to write the save to load"));
+                             Done.Execute();
+                             return;
+                         }
+
+                         auto Scope = MakeShared<FBenchmarkScope>();
+                         UGameplayStatics::AsyncLoadGameFromSlot(
+                             GetSlotName(Case),
+                             0,
+                             FAsyncLoadGameFromSlotDelegate::CreateLambda(
+                                 [this, &Case, Done, Scope](const FString &SlotName, int32, USaveGame *Loaded)
+                                 {
+                                     RecordSample(Case, TEXT("LoadGameFromSlotAsync"), Scope->Stop());
+                                     const auto *LoadedSave = Cast<UPokeSharpSaveGame>(Loaded);
+                                     if (TestNotNull(TEXT("The save was loaded"), LoadedSave))
+                                     {
+                                         TestFalse(TEXT("The save passed its integrity check"),
+                                                   LoadedSave->IsCorrupt());
+                                         const auto LoadedData = LoadedSave->GetData();
+                                         TestTrue(TEXT("The save round-tripped"),
+                                                  LoadedData.Num() == Payload.Num() &&
+                                                      FMemory::Memcmp(LoadedData.GetData(),
+                                                                      Payload.GetData(),
+                                                                      Payload.Num()) == 0);
+                                     }
+
+                                     UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+                                     Done.Execute();
+                                 }));
+                     });
+        });
+}
@@ -0,0 +1,424 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Saving/PokeSharpSavePipeline.h"
+#include "Async/ParallelFor.h"
+#include "Diagnostics/PokeSharpIOStats.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "LogPokeSharpCore.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Saving/PokeSharpSaveContainer.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    /**
+     * A section of the container being written. Dirty sections come from the snapshot, while clean ones are already on
+     * disk and only need their directory entry carried over.
+     */
+    struct FPendingSection
+    {
+        FPokeSharpSaveSectionEntry Entry;
+        TConstArrayView64<uint8> Stored;
+        TArray64<uint8> Compressed;
+        bool bDirty = false;
+    };
+
+    void CompressSection(const FPokeSharpSaveSnapshot::FSection &Section, FPendingSection &Pending)
+    {
+        const auto UncompressedSize = static_cast<int32>(Section.Data.Num());
+        auto &Entry = Pending.Entry;
+        auto CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+        Pending.Compressed.SetNumUninitialized(CompressedSize);
+        if (FCompression::CompressMemory(NAME_Zlib,
+                                         Pending.Compressed.GetData(),
+                                         CompressedSize,
+                                         Section.Data.GetData(),
+                                         UncompressedSize) &&
+            CompressedSize < UncompressedSize)
+        {
+            Pending.Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+            Pending.Stored = Pending.Compressed;
+            Entry.Compression = EPokeSharpDataCompression::Zlib;
+        }
+        else
+        {
+            // Sections that do not shrink are written straight from the snapshot
+            Pending.Compressed.Empty();
+            Pending.Stored = Section.Data;
+            Entry.Compression = EPokeSharpDataCompression::None;
+        }
+
+        Entry.Size = Pending.Stored.Num();
+        Entry.Crc = FCrc::MemCrc32(Pending.Stored.GetData(), static_cast<int32>(Pending.Stored.Num()));
+        Pending.bDirty = true;
+    }
+
+    /**
+     * Builds the header together with the summary block that follows it, so both land on disk in a single write.
+     */
+    TArray<uint8> BuildHeader(const int32 SectionCount,
+                              const int64 DirectoryOffset,
+                              const TConstArrayView<uint8> Directory,
+                              const FPokeSharpSaveSlotSummary *Summary)
+    {
+        TArray<uint8> Header;
+        Header.Reserve(FPokeSharpSaveContainer::DataOffset);
+        FMemoryWriter Writer(Header);
+        FPokeSharpSaveContainer::WriteHeader(Writer, SectionCount, DirectoryOffset, Directory);
+        FPokeSharpSaveContainer::WriteSummary(Writer, Summary);
+        return Header;
+    }
+
+    TArray<uint8> BuildDirectory(const TConstArrayView<FPendingSection> Sections)
+    {
+        TArray<FPokeSharpSaveSectionEntry> Entries;
+        Entries.Reserve(Sections.Num());
+        for (const auto &Section : Sections)
+        {
+            Entries.Add(Section.Entry);
+        }
+
+        return FPokeSharpSaveContainer::WriteDirectory(Entries);
+    }
+
+    /**
+     * Appends the dirty sections and a new directory to the end of an existing container, then points the header at
+     * the new directory. Nothing the old header refers to is touched until that last write.
+     */
+    int64 AppendSections(const FString &SlotPath,
+                         TArray<FPendingSection> &Sections,
+                         const FPokeSharpSaveSlotSummary *Summary,
+                         const int64 ExistingSize)
+    {
+        // Open containers keep reading from the slot, which still works since none of their sections move
+        auto &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*SlotPath, true, true));
+        if (Handle == nullptr || !Handle->Seek(ExistingSize))
+        {
+            return INDEX_NONE;
+        }
+
+        auto Offset = ExistingSize;
+        for (auto &Section : Sections)
+        {
+            if (!Section.bDirty)
+            {
+                continue;
+            }
+
+            if (!Handle->Write(Section.Stored.GetData(), Section.Stored.Num()))
+            {
+                return INDEX_NONE;
+            }
+
+            Section.Entry.Offset = Offset;
+            Offset += Section.Stored.Num();
+        }
+
+        const auto Directory = BuildDirectory(Sections);
+        const auto Header = BuildHeader(Sections.Num(), Offset, Directory, Summary);
+
+        // The new directory has to be on disk before the header is allowed to point at it
+        if (!Handle->Write(Directory.GetData(), Directory.Num()) || !Handle->Flush(true) || !Handle->Seek(0) ||
+            !Handle->Write(Header.GetData(), Header.Num()) || !Handle->Flush(true))
+        {
+            return INDEX_NONE;
+        }
+
+        return Offset - ExistingSize + Directory.Num() + Header.Num();
+    }
+
+    /**
+     * Writes a fresh, compacted container to a temporary file and renames it over the slot. Clean sections are copied
+     * across from the existing container as they are stored, without being inflated again.
+     */
+    int64 RewriteContainer(const FString &SlotPath,
+                           TArray<FPendingSection> &Sections,
+                           const FPokeSharpSaveSlotSummary *Summary)
+    {
+        auto &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const auto TempPath = SlotPath + TEXT(".tmp");
+        PlatformFile.CreateDirectoryTree(*FPaths::GetPath(SlotPath));
+
+        auto Offset = FPokeSharpSaveContainer::DataOffset;
+        bool bWritten;
+        {
+            TUniquePtr<IFileHandle> Existing;
+            if (Sections.ContainsByPredicate([](const FPendingSection &Section) { return !Section.bDirty; }))
+            {
+                Existing.Reset(PlatformFile.OpenRead(*SlotPath));
+            }
+
+            const TUniquePtr<IFileHandle> Writer(PlatformFile.OpenWrite(*TempPath));
+            if (Writer == nullptr)
+            {
+                return INDEX_NONE;
+            }
+
+            // The header is only known once everything else has been written, so reserve its space for now
+            uint8 Placeholder[FPokeSharpSaveContainer::DataOffset] = {};
+            bWritten = Writer->Write(Placeholder, FPokeSharpSaveContainer::DataOffset);
+
+            TArray64<uint8> Scratch;
+            for (auto &Section : Sections)
+            {
+                if (!bWritten)
+                {
+                    break;
+                }
+
+                auto Stored = Section.Stored;
+                if (!Section.bDirty)
+                {
+                    Scratch.SetNumUninitialized(Section.Entry.Size, EAllowShrinking::No);
+                    bWritten = Existing != nullptr && Existing->Seek(Section.Entry.Offset) &&
+                               Existing->Read(Scratch.GetData(), Scratch.Num());
+                    Stored = Scratch;
+                }
+
+                bWritten = bWritten && Writer->Write(Stored.GetData(), Stored.Num());
+                Section.Entry.Offset = Offset;
+                Offset += Stored.Num();
+            }
+
+            const auto Directory = BuildDirectory(Sections);
+            const auto Header = BuildHeader(Sections.Num(), Offset, Directory, Summary);
+            bWritten = bWritten && Writer->Write(Directory.GetData(), Directory.Num()) && Writer->Seek(0) &&
+                       Writer->Write(Header.GetData(), Header.Num()) && Writer->Flush(true);
+            Offset += Directory.Num();
+        }
+
+        if (!bWritten || !IFileManager::Get().Move(*SlotPath, *TempPath, true, true, false, true))
+        {
+            IFileManager::Get().Delete(*TempPath, false, false, true);
+            return INDEX_NONE;
+        }
+
+        return Offset;
+    }
+
+    EPokeSharpSaveResult WriteSnapshot(const FString &SlotPath,
+                                       const FPokeSharpSaveSnapshot &Snapshot,
+                                       const EPokeSharpSaveMode Mode,
+                                       const FPokeSharpSavePipeline::FOnProgress &OnProgress)
+    {
+        POKESHARP_IO_SCOPE(SaveGame, Write, nullptr);
+        const auto SectionCount = Snapshot.Sections.Num();
+
+        // Every section counts as one step, with the write to disk as the final one
+        const auto TotalSteps = static_cast<float>(SectionCount + 1);
+        std::atomic<int32> CompletedSteps = 0;
+        const auto ReportStep = [&]
+        {
+            const auto Completed = ++CompletedSteps;
+            if (OnProgress)
+            {
+                OnProgress(static_cast<float>(Completed) / TotalSteps);
+            }
+        };
+
+        // Whatever is already in the slot decides which of the sections actually have to be written
+        TArray<FPokeSharpSaveSectionEntry> ExistingSections;
+        int64 ExistingSize = 0;
+        TOptional<FPokeSharpSaveSlotSummary> ExistingSummary;
+        if (const TUniquePtr<IFileHandle> Existing(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*SlotPath));
+            Existing != nullptr && FPokeSharpSaveContainer::ReadDirectory(*Existing, ExistingSections))
+        {
+            ExistingSize = Existing->Size();
+            if (!Snapshot.Summary.IsSet() &&
+                !FPokeSharpSaveContainer::ReadSummary(*Existing, ExistingSummary.Emplace()))
+            {
+                ExistingSummary.Reset();
+            }
+        }
+        else if (Mode == EPokeSharpSaveMode::Update)
+        {
+            // An update only holds some of the sections, so writing it without the rest would lose them
+            UE_LOG(LogPokeSharpCore, Log, TEXT("%s does not hold a readable save container to update"), *SlotPath);
+            return EPokeSharpSaveResult::NothingToUpdate;
+        }
+        else
+        {
+            ExistingSections.Reset();
+        }
+
+        // A snapshot without a summary carries the one already in the slot over to the new header
+        const auto *Summary = Snapshot.Summary.IsSet() ? &Snapshot.Summary.GetValue() : ExistingSummary.GetPtrOrNull();
+
+        TArray<FPendingSection> Sections;
+        Sections.SetNum(SectionCount);
+        ParallelFor(SectionCount,
+                    [&](const int32 Index)
+                    {
+                        const auto &Section = Snapshot.Sections[Index];
+                        auto &Pending = Sections[Index];
+                        Pending.Entry.Name = Section.Name;
+                        Pending.Entry.UncompressedSize = Section.Data.Num();
+                        Pending.Entry.Hash = FPokeSharpSaveContainer::HashSection(Section.Data);
+
+                        const auto *Existing = ExistingSections.FindByPredicate(
+                            [&Section](const FPokeSharpSaveSectionEntry &Entry) { return Entry.Name == Section.Name; });
+                        if (Existing != nullptr && Existing->HasSameContents(Pending.Entry))
+                        {
+                            Pending.Entry = *Existing;
+                        }
+                        else
+                        {
+                            CompressSection(Section, Pending);
+                        }
+
+                        ReportStep();
+                    });
+
+        if (Mode == EPokeSharpSaveMode::Update)
+        {
+            for (const auto &Existing : ExistingSections)
+            {
+                if (!Snapshot.Sections.ContainsByPredicate([&Existing](const FPokeSharpSaveSnapshot::FSection &Section)
+                                                           { return Section.Name == Existing.Name; }))
+                {
+                    Sections.Emplace_GetRef().Entry = Existing;
+                }
+            }
+        }
+
+        int64 LiveBytes = FPokeSharpSaveContainer::DataOffset;
+        int64 DirtyBytes = 0;
+        int32 DirtyCount = 0;
+        for (const auto &Section : Sections)
+        {
+            LiveBytes += Section.Entry.Size;
+            if (Section.bDirty)
+            {
+                DirtyBytes += Section.Entry.Size;
+                DirtyCount++;
+            }
+        }
+
+        if (ExistingSize > 0 && DirtyCount == 0 && Sections.Num() == ExistingSections.Num() &&
+            !Snapshot.Summary.IsSet())
+        {
+            // Nothing changed since the last save, so the slot is already up to date
+            ReportStep();
+            return EPokeSharpSaveResult::Succeeded;
+        }
+
+        // Updates leave stale sections behind, so once they would make up most of the file it is compacted instead
+        const bool bAppend = ExistingSize > 0 && LiveBytes * 2 >= ExistingSize + DirtyBytes;
+        const auto BytesWritten = bAppend ? AppendSections(SlotPath, Sections, Summary, ExistingSize)
+                                          : RewriteContainer(SlotPath, Sections, Summary);
+        if (BytesWritten == INDEX_NONE)
+        {
+            return EPokeSharpSaveResult::Failed;
+        }
+
+        PokeSharpIOScope.Bytes = BytesWritten;
+        ReportStep();
+        return EPokeSharpSaveResult::Succeeded;
+    }
+} // namespace
+
+void FPokeSharpSaveSnapshot::AddSection(FString &&Name, const TConstArrayView64<uint8> Data)
+{
+    Sections.Emplace(FSection{.Name = MoveTemp(Name), .Data = TArray64<uint8>(Data)});
+}
+
+FPokeSharpSavePipeline &FPokeSharpSavePipeline::Get()
+{
+    static FPokeSharpSavePipeline Instance;
+    return Instance;
+}
+
+void FPokeSharpSavePipeline::Submit(const FString &SlotName,
+                                    TSharedRef<const FPokeSharpSaveSnapshot> Snapshot,
+                                    const EPokeSharpSaveMode Mode,
+                                    FOnProgress &&OnProgress,
+                                    FOnCompleted &&OnCompleted)
+{
+    if (!FPokeSharpSaveContainer::IsSupported())
+    {
+        UE_LOG(LogPokeSharpCore, Error, TEXT("Save containers are not supported on this platform"));
+        OnCompleted(EPokeSharpSaveResult::Failed);
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    PruneCompletedSaves();
+    auto &Pending = PendingSaves.FindOrAdd(SlotName);
+
+    // Chaining onto the previous save to the slot keeps two saves from racing each other, and lets the later one see
+    // what the earlier one wrote
+    TArray<UE::Tasks::FTask, TInlineAllocator<1>> Prerequisites;
+    if (Pending.IsValid())
+    {
+        Prerequisites.Add(Pending);
+    }
+
+    Pending = UE::Tasks::Launch(
+        UE_SOURCE_LOCATION,
+        [SlotPath = FPokeSharpSaveContainer::GetSlotPath(SlotName),
+         Snapshot = MoveTemp(Snapshot),
+         Mode,
+         OnProgress = MoveTemp(OnProgress),
+         OnCompleted = MoveTemp(OnCompleted)]
+        {
+            const auto Result = WriteSnapshot(SlotPath, *Snapshot, Mode, OnProgress);
+            if (Result == EPokeSharpSaveResult::Failed)
+            {
+                UE_LOG(LogPokeSharpCore, Error, TEXT("Failed to write save to %s"), *SlotPath);
+            }
+
+            OnCompleted(Result);
+        },
+        Prerequisites);
+}
+
+void FPokeSharpSavePipeline::WaitForSlot(const FStringView SlotName)
+{
+    UE::Tasks::FTask Task;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (const auto *Pending = PendingSaves.FindByHash(GetTypeHash(SlotName), SlotName))
+        {
+            Task = *Pending;
+        }
+    }
+
+    if (Task.IsValid())
+    {
+        Task.Wait();
+    }
+}
+
+void FPokeSharpSavePipeline::Flush()
+{
+    // The tasks stay in the map while they run, so saves submitted in the meantime still chain onto them
+    TArray<UE::Tasks::FTask> Saves;
+    {
+        FScopeLock ScopeLock(&Lock);
+        PendingSaves.GenerateValueArray(Saves);
+    }
+
+    for (auto &Task : Saves)
+    {
+        Task.Wait();
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    PruneCompletedSaves();
+}
+
+void FPokeSharpSavePipeline::PruneCompletedSaves()
+{
+    for (auto It = PendingSaves.CreateIterator(); It; ++It)
+    {
+        if (It->Value.IsCompleted())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Saving/PokeSharpSaveSlotIndex.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Saving/PokeSharpSaveContainer.h"
+#include "Saving/PokeSharpSavePipeline.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+    bool ReadSlotSummary(const FString &SlotName, FPokeSharpSaveSlotSummary &OutSummary)
+    {
+        // A slot still being written would otherwise show up with its previous summary
+        FPokeSharpSavePipeline::Get().WaitForSlot(SlotName);
+
+        const auto SlotPath = FPokeSharpSaveContainer::GetSlotPath(SlotName);
+        const TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*SlotPath));
+        if (Handle == nullptr)
+        {
+            return false;
+        }
+
+        OutSummary = FPokeSharpSaveSlotSummary();
+        if (!FPokeSharpSaveContainer::ReadSummary(*Handle, OutSummary))
+        {
+            // Older saves have nothing to show beyond when they were last written
+            OutSummary = FPokeSharpSaveSlotSummary();
+            OutSummary.Timestamp = IFileManager::Get().GetTimeStamp(*SlotPath);
+        }
+
+        OutSummary.SlotName = SlotName;
+        return true;
+    }
+} // namespace
+
+TArray<FPokeSharpSaveSlotSummary> UPokeSharpSaveSlotIndex::GetSlotSummaries()
+{
+    TArray<FString> FileNames;
+    const auto SaveDirectory = FPaths::GetPath(FPokeSharpSaveContainer::GetSlotPath(TEXT("")));
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(SaveDirectory, TEXT("*.sav")), true, false);
+
+    TArray<FPokeSharpSaveSlotSummary> Summaries;
+    Summaries.SetNum(FileNames.Num());
+    TArray<bool> Found;
+    Found.SetNumZeroed(FileNames.Num());
+    ParallelFor(FileNames.Num(),
+                [&](const int32 Index)
+                { Found[Index] = ReadSlotSummary(FPaths::GetBaseFilename(FileNames[Index]), Summaries[Index]); });
+
+    for (int32 i = Summaries.Num() - 1; i >= 0; i--)
+    {
+        if (!Found[i])
+        {
+            Summaries.RemoveAtSwap(i, EAllowShrinking::No);
+        }
+    }
+
+    Summaries.Sort([](const FPokeSharpSaveSlotSummary &A, const FPokeSharpSaveSlotSummary &B)
+                   { return A.Timestamp > B.Timestamp; });
+    return Summaries;
+}
+
+bool UPokeSharpSaveSlotIndex::GetSlotSummary(const FString &SlotName, FPokeSharpSaveSlotSummary &OutSummary)
+{
+    return ReadSlotSummary(SlotName, OutSummary);
+}
+
+void UGetSaveSlotSummariesAsync::GetSlotSummaries()
+{
+    TWeakObjectPtr WeakThis = this;
+    UE::Tasks::Launch(UE_SOURCE_LOCATION,
+                      [WeakThis]
+                      {
+                          auto Result = UPokeSharpSaveSlotIndex::GetSlotSummaries();
+                          AsyncTask(ENamedThreads::GameThread,
+                                    [WeakThis, Result = MoveTemp(Result)]() mutable
+                                    {
+                                        if (auto *This = WeakThis.Get(); This != nullptr)
+                                        {
+                                            This->Summaries = MoveTemp(Result);
+                                            This->InvokeManagedCallback();
+                                        }
+                                    });
+                      });
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Saving/PokeSharpSaveSlotOps.h"
+#include "Async/Async.h"
+#include "Diagnostics/PokeSharpIOStats.h"
+#include "LogPokeSharpCore.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Saving/PokeSharpSavePipeline.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+    ISaveGameSystem &GetSaveGameSystem()
+    {
+        auto *SaveGameSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+        check(SaveGameSystem != nullptr);
+        return *SaveGameSystem;
+    }
+} // namespace
+
+void UPokeSharpSaveSlotOps::CopySlot(const FString &SourceSlotName,
+                                     const FString &DestinationSlotName,
+                                     const int32 UserIndex)
+{
+    RunOnWorker([SourceSlotName, DestinationSlotName, UserIndex]
+                { return CopySlotBlocking(SourceSlotName, DestinationSlotName, UserIndex); });
+}
+
+void UPokeSharpSaveSlotOps::RenameSlot(const FString &SourceSlotName,
+                                       const FString &DestinationSlotName,
+                                       const int32 UserIndex)
+{
+    RunOnWorker([SourceSlotName, DestinationSlotName, UserIndex]
+                { return RenameSlotBlocking(SourceSlotName, DestinationSlotName, UserIndex); });
+}
+
+void UPokeSharpSaveSlotOps::DeleteSlot(const FString &SlotName, const int32 UserIndex)
+{
+    RunOnWorker([SlotName, UserIndex] { return DeleteSlotBlocking(SlotName, UserIndex); });
+}
+
+bool UPokeSharpSaveSlotOps::CopySlotBlocking(const FString &SourceSlotName,
+                                             const FString &DestinationSlotName,
+                                             const int32 UserIndex)
+{
+    POKESHARP_IO_SCOPE(SaveGame, Write, nullptr);
+    auto &Pipeline = FPokeSharpSavePipeline::Get();
+    Pipeline.WaitForSlot(SourceSlotName);
+    Pipeline.WaitForSlot(DestinationSlotName);
+
+    auto &SaveGameSystem = GetSaveGameSystem();
+    const auto PlatformUser = FPlatformMisc::GetPlatformUserForUserIndex(UserIndex);
+    TArray<uint8> Data;
+    if (!SaveGameSystem.LoadGame(false, *SourceSlotName, PlatformUser, Data) ||
+        !SaveGameSystem.SaveGame(false, *DestinationSlotName, PlatformUser, Data))
+    {
+        UE_LOG(LogPokeSharpCore,
+               Error,
+               TEXT("Failed to copy save slot %s to %s"),
+               *SourceSlotName,
+               *DestinationSlotName);
+        return false;
+    }
+
+    PokeSharpIOScope.Bytes = Data.Num();
+    return true;
+}
+
+bool UPokeSharpSaveSlotOps::RenameSlotBlocking(const FString &SourceSlotName,
+                                               const FString &DestinationSlotName,
+                                               const int32 UserIndex)
+{
+    return CopySlotBlocking(SourceSlotName, DestinationSlotName, UserIndex) &&
+           DeleteSlotBlocking(SourceSlotName, UserIndex);
+}
+
+bool UPokeSharpSaveSlotOps::DeleteSlotBlocking(const FString &SlotName, const int32 UserIndex)
+{
+    FPokeSharpSavePipeline::Get().WaitForSlot(SlotName);
+    return GetSaveGameSystem().DeleteGame(false, *SlotName, FPlatformMisc::GetPlatformUserForUserIndex(UserIndex));
+}
+
+void UPokeSharpSaveSlotOps::RunOnWorker(TUniqueFunction<bool()> &&Operation)
+{
+    TWeakObjectPtr WeakThis = this;
+    UE::Tasks::Launch(UE_SOURCE_LOCATION,
+                      [WeakThis, Operation = MoveTemp(Operation)]
+                      {
+                          const bool bResult = Operation();
+                          AsyncTask(ENamedThreads::GameThread,
+                                    [WeakThis, bResult]
+                                    {
+                                        if (auto *This = WeakThis.Get(); This != nullptr)
+                                        {
+                                            This->bSucceeded = bResult;
+                                            This->InvokeManagedCallback();
+                                        }
+                                    });
+                      });
+}
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Strings/PokeSharpNameDisplayTable.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    constexpr int32 ChunkSize = 64 * 1024;
+} // namespace
+
+FPokeSharpNameDisplayTable &FPokeSharpNameDisplayTable::Get()
+{
+    static FPokeSharpNameDisplayTable Instance;
+    return Instance;
+}
+
+void FPokeSharpNameDisplayTable::Register(const FName Name)
+{
+    static_assert(sizeof(FSlot) == sizeof(const UTF16CHAR *), "Managed code reads the slots as plain pointers");
+    static_assert(sizeof(std::atomic<FSlot *>) == sizeof(FSlot *), "Managed code reads the blocks as plain pointers");
+    static_assert(sizeof(std::atomic<uint32>) == sizeof(uint32), "Managed code reads the generation as a uint32");
+    static_assert(sizeof(WIDECHAR) == sizeof(UTF16CHAR), "Wide name entries are copied into the table as UTF-16");
+
+    const auto DisplayIndex = Name.GetDisplayIndex().ToUnstableInt();
+    const auto Block = DisplayIndex >> FNameBlockOffsetBits;
+    const auto Offset = DisplayIndex & (FNameBlockOffsets - 1);
+
+    auto *Slots = Blocks[Block].load(std::memory_order_acquire);
+    if (Slots != nullptr && Slots[Offset].load(std::memory_order_acquire) != nullptr)
+    {
+        return;
+    }
+
+    FScopeLock Lock(&WriteLock);
+    Slots = Blocks[Block].load(std::memory_order_relaxed);
+    if (Slots == nullptr)
+    {
+        // Blocks are never freed, since managed code may still be reading from them
+        Slots = new FSlot[FNameBlockOffsets]{};
+        Blocks[Block].store(Slots, std::memory_order_release);
+    }
+    else if (Slots[Offset].load(std::memory_order_relaxed) != nullptr)
+    {
+        return;
+    }
+
+    const auto *Entry = Name.GetDisplayNameEntry();
+    const auto Length = Entry->GetNameLength();
+    auto *Destination = AllocateEntry(Length);
+    if (Entry->IsWide())
+    {
+        WIDECHAR Buffer[NAME_SIZE];
+        Entry->GetWideName(Buffer);
+        FMemory::Memcpy(Destination + 1, Buffer, Length * sizeof(UTF16CHAR));
+    }
+    else
+    {
+        ANSICHAR Buffer[NAME_SIZE];
+        Entry->GetAnsiName(Buffer);
+        for (int32 i = 0; i < Length; i++)
+        {
+            Destination[i + 1] = static_cast<UTF16CHAR>(static_cast<uint8>(Buffer[i]));
+        }
+    }
+
+    Slots[Offset].store(Destination, std::memory_order_release);
+    Generation.fetch_add(1, std::memory_order_release);
+}
+
+void FPokeSharpNameDisplayTable::GetView(FPokeSharpNameDisplayTableView &OutView) const
+{
+    OutView.Blocks = Blocks;
+    OutView.Generation = reinterpret_cast<const uint32 *>(&Generation);
+    OutView.BlockCount = FNameMaxBlocks;
+    OutView.OffsetBits = FNameBlockOffsetBits;
+}
+
+UTF16CHAR *FPokeSharpNameDisplayTable::AllocateEntry(const int32 Length)
+{
+    // Each entry is a uint16 length followed by the characters, with no terminator
+    const auto EntrySize = Length + 1;
+    if (Chunks.IsEmpty() || ChunkUsed + EntrySize > ChunkSize)
+    {
+        Chunks.Emplace(MakeUnique<UTF16CHAR[]>(ChunkSize));
+        ChunkUsed = 0;
+    }
+
+    auto *Entry = Chunks.Last().Get() + ChunkUsed;
+    ChunkUsed += EntrySize;
+    Entry[0] = static_cast<UTF16CHAR>(Length);
+    return Entry;
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Strings/PokeSharpTextCache.h"
+#include "Internationalization/StringTableCore.h"
+#include "Internationalization/StringTableRegistry.h"
+#include "Internationalization/TextLocalizationManager.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    bool HasSourceString(const FText &Text, const FStringView Source)
+    {
+        const auto *SourceString = FTextInspector::GetSourceString(Text);
+        return SourceString != nullptr && FStringView(*SourceString).Equals(Source, ESearchCase::CaseSensitive);
+    }
+} // namespace
+
+FPokeSharpTextCache::FPokeSharpTextCache()
+{
+    // The cache lives for the rest of the process, so the binding is never removed
+    FTextLocalizationManager::Get().OnTextRevisionChangedEvent.AddLambda(
+        [this] { CultureGeneration.fetch_add(1, std::memory_order_release); });
+}
+
+FPokeSharpTextCache &FPokeSharpTextCache::Get()
+{
+    static FPokeSharpTextCache Instance;
+    return Instance;
+}
+
+int32 FPokeSharpTextCache::FindOrAddLocalized(const FStringView Namespace,
+                                              const FStringView Key,
+                                              const FStringView Source,
+                                              FText &OutText)
+{
+    const TPair<FTextKey, FTextKey> TextId(FTextKey(Namespace), FTextKey(Key));
+    {
+        FReadScopeLock ReadLock(Lock);
+        const auto *Handle = LocalizedHandles.Find(TextId);
+        if (Handle != nullptr && HasSourceString(Texts[*Handle], Source))
+        {
+            OutText = Texts[*Handle];
+            return *Handle;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    auto &Handle = LocalizedHandles.FindOrAdd(TextId, INDEX_NONE);
+    if (Handle == INDEX_NONE)
+    {
+        Handle = AddText(FText::AsLocalizable_Advanced(TextId.Key, TextId.Value, Source));
+    }
+    else if (!HasSourceString(Texts[Handle], Source))
+    {
+        // The old source is evicted rather than kept alongside, so editing a text over and over does not keep adding
+        // new ones. Managed copies of the old display string are stale from here on, just like after a culture change.
+        Texts[Handle] = FText::AsLocalizable_Advanced(TextId.Key, TextId.Value, Source);
+        CultureGeneration.fetch_add(1, std::memory_order_release);
+    }
+
+    OutText = Texts[Handle];
+    return Handle;
+}
+
+int32 FPokeSharpTextCache::FindOrAddLocText(const FStringView LocText, FText &OutText)
+{
+    const auto Hash = FLocTextKeyFuncs::GetKeyHash(LocText);
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const auto *Handle = LocTextHandles.FindByHash(Hash, LocText))
+        {
+            OutText = Texts[*Handle];
+            return *Handle;
+        }
+    }
+
+    // ReadFromBuffer expects a null-terminated buffer
+    const FString Buffer(LocText);
+    if (!FTextStringHelper::ReadFromBuffer(*Buffer, OutText))
+    {
+        OutText = FText::FromStringView(LocText);
+        return INDEX_NONE;
+    }
+
+    if (!FTextInspector::GetKey(OutText).IsSet())
+    {
+        return INDEX_NONE;
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    auto &Handle = LocTextHandles.FindOrAdd(Buffer, INDEX_NONE);
+    if (Handle == INDEX_NONE)
+    {
+        Handle = AddText(CopyTemp(OutText));
+    }
+
+    return Handle;
+}
+
+int32 FPokeSharpTextCache::FindOrAddStringTableEntry(const FName TableId, const FStringView Key, FText &OutText)
+{
+    const TPair<FName, FTextKey> EntryId(TableId, FTextKey(Key));
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const auto *Handle = StringTableHandles.Find(EntryId))
+        {
+            OutText = Texts[*Handle];
+            return *Handle;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    auto &Handle = StringTableHandles.FindOrAdd(EntryId, INDEX_NONE);
+    if (Handle == INDEX_NONE)
+    {
+        Handle = AddText(FText::FromStringTable(TableId, EntryId.Value));
+    }
+
+    OutText = Texts[Handle];
+    return Handle;
+}
+
+int32 FPokeSharpTextCache::PreloadStringTable(const FName TableId)
+{
+    const auto Table = FStringTableRegistry::Get().FindStringTable(TableId);
+    if (!Table.IsValid())
+    {
+        return 0;
+    }
+
+    // Gather the keys first, since building a text from a string table looks the table up again
+    TArray<FString> Keys;
+    Table->EnumerateSourceStrings(
+        [&Keys](const FString &Key, const FString &)
+        {
+            Keys.Add(Key);
+            return true;
+        });
+
+    FWriteScopeLock WriteLock(Lock);
+    Texts.Reserve(Texts.Num() + Keys.Num());
+    for (const auto &Key : Keys)
+    {
+        const TPair<FName, FTextKey> EntryId(TableId, FTextKey(Key));
+        auto &Handle = StringTableHandles.FindOrAdd(EntryId, INDEX_NONE);
+        if (Handle == INDEX_NONE)
+        {
+            Handle = AddText(FText::FromStringTable(TableId, EntryId.Value));
+        }
+    }
+
+    return Keys.Num();
+}
+
+bool FPokeSharpTextCache::TryGetText(const int32 Handle, FText &OutText) const
+{
+    FReadScopeLock ReadLock(Lock);
+    if (!Texts.IsValidIndex(Handle))
+    {
+        return false;
+    }
+
+    OutText = Texts[Handle];
+    return true;
+}
+
+const uint32 *FPokeSharpTextCache::GetCultureGeneration() const
+{
+    static_assert(sizeof(std::atomic<uint32>) == sizeof(uint32), "Managed code reads the generation as a uint32");
+    return reinterpret_cast<const uint32 *>(&CultureGeneration);
+}
+
+int32 FPokeSharpTextCache::AddText(FText &&Text)
+{
+    return Texts.Emplace(MoveTemp(Text));
+}
\ No newline at end of file
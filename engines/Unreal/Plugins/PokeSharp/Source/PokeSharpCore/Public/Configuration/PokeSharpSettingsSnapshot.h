@@ -0,0 +1,25 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Writes the config properties of a settings object into a single MessagePack blob, so managed code can read the
+ * whole object in one pass instead of going through its reflected properties one at a time.
+ *
+ * The blob is an array holding the schema hash of the settings class followed by a map from property name to value.
+ * Structs are written as maps keyed by their property names and optionals that are not set are written as nil, which
+ * matches how the managed serializer reads string-keyed objects.
+ */
+class POKESHARPCORE_API FPokeSharpSettingsSnapshot
+{
+  public:
+    /**
+     * Hashes the names and types of the config properties of a settings class, including the properties of every
+     * struct they contain. The hash changes whenever the layout of the snapshot does.
+     */
+    static uint32 ComputeSchemaHash(const UClass &Class);
+
+    static void Write(const UObject &Settings, TArray<uint8> &OutBuffer);
+};
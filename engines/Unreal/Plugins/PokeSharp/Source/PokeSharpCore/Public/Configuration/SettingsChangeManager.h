@@ -32,25 +32,13 @@ struct FSettingsChangeDelegateCallback
     FCSManagedDelegate Delegate;
 };
 
-struct FDebouncedSettingsCallback
-{
-    explicit FDebouncedSettingsCallback(const TSharedRef<FSettingsChangeDelegateCallback> &InCallback)
-        : Callback(InCallback)
-    {
-    }
-
-    void RequestExecution(float DebounceSeconds);
-
-  private:
-    bool OnTick(float /*DeltaTime*/);
-
-    TSharedRef<FSettingsChangeDelegateCallback> Callback;
-    bool bPendingExecution = false;
-    FTSTicker::FDelegateHandle TickerHandle;
-};
-
 /**
+ * Collects changes to the config properties of settings objects and tells every binding about them in batches. All
+ * changes made within the debounce window are dispatched together from a single ticker, and each binding is invoked
+ * at most once per batch with the names of the properties that changed on its settings object.
  *
+ * Changes are picked up from edits in the editor as well as from config sections being reloaded at runtime, such as
+ * by a hotfix.
  */
 UCLASS()
 class POKESHARPCORE_API USettingsChangeManager : public UObject
@@ -69,7 +57,40 @@ class POKESHARPCORE_API USettingsChangeManager : public UObject
     FGuid Bind(UDeveloperSettings *Settings, const FGCHandle &ManagedDelegate) noexcept;
     void Unbind(const FGuid &Guid) noexcept;
 
+    /**
+     * Marks a config property of a settings object as changed. The bindings of the object are notified on the next
+     * dispatch.
+     * @param PropertyName The name of the top-level property, or NAME_None if every property may have changed
+     */
+    void MarkDirty(UDeveloperSettings &Settings, FName PropertyName);
+
+    /**
+     * The names of the properties that changed for the binding currently being invoked. Only valid while a callback
+     * is running.
+     */
+    TConstArrayView<FName> GetChangedProperties() const
+    {
+        return DispatchingProperties;
+    }
+
   private:
+    struct FBinding
+    {
+        TWeakObjectPtr<UDeveloperSettings> Settings;
+        TSharedRef<FSettingsChangeDelegateCallback> Callback;
+    };
+
+#if WITH_EDITOR
+    void OnSettingChanged(UObject *Settings, FPropertyChangedEvent &PropertyChangedEvent);
+#endif
+    void OnConfigSectionsChanged(const FString &IniFilename, const TSet<FString> &SectionNames);
+    bool Dispatch(float DeltaTime);
+
     static TObjectPtr<USettingsChangeManager> Instance;
-    TMap<FGuid, TSharedRef<FDebouncedSettingsCallback>> Callbacks;
+    TMap<FGuid, FBinding> Bindings;
+    TSet<TWeakObjectPtr<UDeveloperSettings>> BoundSettings;
+    TMap<TWeakObjectPtr<UDeveloperSettings>, TSet<FName>> DirtyProperties;
+    TArray<FName> DispatchingProperties;
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle ConfigSectionsChangedHandle;
 };
@@ -0,0 +1,77 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * How the bytes of an archive entry are stored. Matches the managed DataArchiveCompression enum.
+ */
+enum class EPokeSharpDataCompression : uint8
+{
+    None = 0,
+    Zlib = 1
+};
+
+/**
+ * A single entry in the table of contents of a data archive.
+ */
+struct FPokeSharpDataArchiveEntry
+{
+    int64 Offset = 0;
+    int64 Size = 0;
+    int64 UncompressedSize = 0;
+    uint32 Crc = 0;
+    EPokeSharpDataCompression Compression = EPokeSharpDataCompression::None;
+};
+
+/**
+ * A packed archive of game data files. The archive starts with a fixed 64-byte header followed by the table of
+ * contents, and every entry begins on a 64-byte boundary. All entries are read through a single shared file handle.
+ *
+ * Layout (little-endian):
+ *  - Header: uint32 Magic ('PKAR'), uint32 Version, uint32 EntryCount, uint32 TocSize, padded to 64 bytes
+ *  - Per entry: uint16 NameLength, UTF-8 Name, uint8 Compression, int64 Offset, int64 Size, int64 UncompressedSize,
+ *    uint32 Crc32 (of the stored bytes)
+ */
+class POKESHARPCORE_API FPokeSharpDataArchive : public TSharedFromThis<FPokeSharpDataArchive>
+{
+  public:
+    static constexpr uint32 Magic = 0x52414B50;
+    static constexpr uint32 Version = 1;
+    static constexpr int64 HeaderSize = 64;
+
+    explicit FPokeSharpDataArchive(TUniquePtr<IFileHandle> &&InHandle);
+    ~FPokeSharpDataArchive();
+
+    /**
+     * Opens the archive at the given absolute path and reads its table of contents.
+     * @param FileName The absolute path of the archive
+     * @return The opened archive, or nullptr if the file is missing or is not a valid archive
+     */
+    static TSharedPtr<FPokeSharpDataArchive> Open(const FString &FileName);
+
+    const FPokeSharpDataArchiveEntry *FindEntry(FStringView Name) const;
+
+    /**
+     * Opens a read-only handle over a single entry. Uncompressed entries are read straight from the shared handle,
+     * while compressed entries are inflated into memory and verified against their checksum.
+     * @param Name The name of the entry to open
+     * @return The handle, or nullptr if the entry does not exist or could not be read
+     */
+    IFileHandle *OpenEntry(FStringView Name);
+
+    /**
+     * Reads a block of bytes from the shared handle. Safe to call from multiple threads.
+     */
+    bool ReadAt(int64 Offset, uint8 *Destination, int64 Size);
+
+  private:
+    bool ReadTableOfContents();
+
+    TUniquePtr<IFileHandle> Handle;
+    FCriticalSection HandleLock;
+    TMap<FString, FPokeSharpDataArchiveEntry> Entries;
+};
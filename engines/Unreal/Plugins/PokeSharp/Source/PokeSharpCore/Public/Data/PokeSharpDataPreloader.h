@@ -0,0 +1,55 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+
+/**
+ * Reads every data file under the configured data path into memory in parallel on the task graph as soon as the
+ * module starts up, so that disk latency overlaps with engine initialization. Managed data loaders claim the buffers
+ * by the full path of the file, after which they own them.
+ */
+class POKESHARPCORE_API FPokeSharpDataPreloader
+{
+  public:
+    using FBuffer = TArray64<uint8>;
+
+    static FPokeSharpDataPreloader &Get();
+
+    /**
+     * Launches a background read for every data file in the given directory.
+     * @param Directory The absolute path of the directory containing the data files
+     */
+    void Start(const FString &Directory);
+
+    /**
+     * Claims the preloaded contents of a file, waiting for the read to complete if it is still in flight.
+     * @param FilePath The path of the file, either absolute or relative to the working directory
+     * @return The contents of the file, or nullptr if it was never preloaded, has already been claimed or failed to
+     * read. Ownership passes to the caller.
+     */
+    TUniquePtr<FBuffer> Claim(FStringView FilePath);
+
+    /**
+     * Drops a file without claiming it, for instance because it is about to be rewritten.
+     * @param FilePath The path of the file, either absolute or relative to the working directory
+     */
+    void Discard(FStringView FilePath);
+
+    /**
+     * Waits for any outstanding reads and releases all unclaimed buffers.
+     */
+    void Reset();
+
+  private:
+    /**
+     * Files are keyed by their full path, so files with the same name in different directories never mix.
+     */
+    static FString GetFileKey(FStringView FilePath);
+
+    using FReadTask = UE::Tasks::TTask<TUniquePtr<FBuffer>>;
+
+    FCriticalSection Lock;
+    TMap<FString, FReadTask> PendingFiles;
+};
@@ -22,6 +22,13 @@ class POKESHARPCORE_API UPokeSharpDataSettings : public UDeveloperSettings
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "FilePaths", meta = (ContentDir))
     FDirectoryPath DataPath;
 
+    /**
+     * The size of the blocks that data files are split into when they are written with block compression, or 0 to
+     * write them uncompressed. Compressed files can still be read regardless of this setting.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Compression", meta = (ClampMin = 0))
+    int32 CompressionBlockSize = 0;
+
   protected:
 #if WITH_EDITOR
     FText GetSectionText() const override;
@@ -0,0 +1,123 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+DECLARE_STATS_GROUP(TEXT("PokeSharp I/O"), STATGROUP_PokeSharpIO, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Read"), STAT_PokeSharpIO_Read, STATGROUP_PokeSharpIO, POKESHARPCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Write"), STAT_PokeSharpIO_Write, STATGROUP_PokeSharpIO, POKESHARPCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Seek"), STAT_PokeSharpIO_Seek, STATGROUP_PokeSharpIO, POKESHARPCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Read"), STAT_PokeSharpIO_BytesRead, STATGROUP_PokeSharpIO,
+                                  POKESHARPCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Written"), STAT_PokeSharpIO_BytesWritten, STATGROUP_PokeSharpIO,
+                                  POKESHARPCORE_API);
+
+UE_TRACE_CHANNEL_EXTERN(PokeSharpIOChannel, POKESHARPCORE_API);
+
+/**
+ * The interop surface an I/O operation went through. Matches the managed IOSource enum.
+ */
+enum class EPokeSharpIOSource : uint8
+{
+    FileHandle,
+    Archive,
+    SaveGame,
+
+    Num
+};
+
+/**
+ * The kind of I/O operation being recorded.
+ */
+enum class EPokeSharpIOOperation : uint8
+{
+    Read,
+    Write,
+    Seek
+};
+
+/**
+ * A point-in-time copy of a set of I/O counters. The latency histograms use power-of-two microsecond buckets: bucket 0
+ * holds operations under 1us, bucket N holds operations in [2^(N-1), 2^N) us and the last bucket holds everything
+ * slower than that. Matches the managed IOStatsSnapshot struct.
+ */
+struct FPokeSharpIOSnapshot
+{
+    static constexpr int32 LatencyBucketCount = 16;
+
+    int64 ReadCalls = 0;
+    int64 BytesRead = 0;
+    int64 WriteCalls = 0;
+    int64 BytesWritten = 0;
+    int64 SeekCalls = 0;
+    int64 ReadLatency[LatencyBucketCount] = {};
+    int64 WriteLatency[LatencyBucketCount] = {};
+};
+
+/**
+ * Collects counters for every read, write and seek that goes through the file handle, archive and save game
+ * exporters. Aggregate counters per source are always kept; per-handle counters are only kept while the
+ * PokeSharp.IO.TrackHandles console variable is enabled, since they need a lock.
+ */
+class POKESHARPCORE_API FPokeSharpIOStats
+{
+  public:
+    static void Record(EPokeSharpIOSource Source,
+                       EPokeSharpIOOperation Operation,
+                       const void *Handle,
+                       int64 Bytes,
+                       uint64 StartCycles,
+                       uint64 EndCycles);
+
+    /**
+     * Drops the per-handle counters of a handle that is being closed.
+     */
+    static void ForgetHandle(const void *Handle);
+
+    static void GetSnapshot(EPokeSharpIOSource Source, FPokeSharpIOSnapshot &OutSnapshot);
+    static bool GetHandleSnapshot(const void *Handle, FPokeSharpIOSnapshot &OutSnapshot);
+    static void Reset();
+};
+
+/**
+ * Times a single I/O operation and records it when it goes out of scope. Set Bytes to the number of bytes that were
+ * actually transferred.
+ */
+struct FPokeSharpIOScope
+{
+    UE_NONCOPYABLE(FPokeSharpIOScope)
+
+    FPokeSharpIOScope(const EPokeSharpIOSource InSource,
+                      const EPokeSharpIOOperation InOperation,
+                      const void *InHandle)
+        : Source(InSource), Operation(InOperation), Handle(InHandle), StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FPokeSharpIOScope()
+    {
+        FPokeSharpIOStats::Record(Source, Operation, Handle, Bytes, StartCycles, FPlatformTime::Cycles64());
+    }
+
+    int64 Bytes = 0;
+
+  private:
+    EPokeSharpIOSource Source;
+    EPokeSharpIOOperation Operation;
+    const void *Handle;
+    uint64 StartCycles;
+};
+
+/**
+ * Instruments the enclosing scope as an I/O operation in the stat group, the trace channel and the counters. Declares
+ * a local named PokeSharpIOScope whose Bytes should be filled in before the scope ends.
+ */
+#define POKESHARP_IO_SCOPE(Source, Operation, Handle)                                                                  \
+    SCOPE_CYCLE_COUNTER(STAT_PokeSharpIO_##Operation);                                                                 \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("PokeSharpIO::" #Source "::" #Operation, PokeSharpIOChannel);        \
+    FPokeSharpIOScope PokeSharpIOScope(EPokeSharpIOSource::Source, EPokeSharpIOOperation::Operation, Handle)
@@ -0,0 +1,106 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+/**
+ * The compression format used for every block of a block-compressed file. Matches the managed
+ * BlockCompressionFormat enum.
+ */
+enum class EPokeSharpBlockCompression : uint8
+{
+    Zlib = 1,
+    Gzip = 2,
+    LZ4 = 3,
+    Oodle = 4
+};
+
+/**
+ * Presents a block-compressed data file as a regular read-only file handle. The file is split into fixed-size blocks
+ * that are compressed independently, with a block index up front, so seeking only ever has to decompress the blocks
+ * that are actually read. Reads that span several blocks decompress them in parallel on worker threads.
+ *
+ * Layout (little-endian):
+ *  - Header: uint32 Magic ('PKBC'), uint32 Version, uint32 BlockSize, uint32 BlockCount, int64 UncompressedSize,
+ *    uint8 Compression, padded to 32 bytes
+ *  - Block index: BlockCount + 1 int64 offsets from the start of the file, the last one marking the end of the data
+ *  - Blocks: a block whose stored size equals its uncompressed size is stored as-is
+ */
+class POKESHARPCORE_API FBlockCompressedFileHandle final : public IFileHandle
+{
+  public:
+    static constexpr uint32 Magic = 0x43424B50;
+    static constexpr uint32 Version = 1;
+    static constexpr int32 HeaderSize = 32;
+
+    /**
+     * Checks if a handle points at a block-compressed file. The position of the handle is left untouched.
+     */
+    static bool IsBlockCompressed(IFileHandle &Handle);
+
+    /**
+     * Checks if an in-memory buffer holds a block-compressed file.
+     */
+    static bool IsBlockCompressed(TConstArrayView64<uint8> Data);
+
+    /**
+     * Opens a block-compressed file on top of the given handle.
+     * @return The decompressing handle, or nullptr if the header or block index is invalid
+     */
+    static TUniquePtr<IFileHandle> Open(TUniquePtr<IFileHandle> &&Handle);
+
+    /**
+     * Decompresses an entire block-compressed file that has already been read into memory.
+     */
+    static bool Decompress(TConstArrayView64<uint8> Data, TArray64<uint8> &OutData);
+
+    int64 Tell() override;
+    bool Seek(int64 NewPosition) override;
+    bool SeekFromEnd(int64 NewPositionRelativeToEnd = 0) override;
+    bool Read(uint8 *Destination, int64 BytesToRead) override;
+    bool Write(const uint8 *Source, int64 BytesToWrite) override;
+    bool Flush(bool bFullFlush = false) override;
+    bool Truncate(int64 NewSize) override;
+    int64 Size() override;
+    void ShrinkBuffers() override;
+
+  private:
+    struct FBlockIndex
+    {
+        FName Format;
+        int64 BlockSize = 0;
+        int64 UncompressedSize = 0;
+        TArray<int64> Offsets;
+
+        int32 Num() const
+        {
+            return Offsets.Num() - 1;
+        }
+
+        int64 GetStoredSize(const int32 Block) const
+        {
+            return Offsets[Block + 1] - Offsets[Block];
+        }
+
+        int64 GetUncompressedSize(int32 Block) const;
+        bool DecompressBlock(int32 Block, const uint8 *Source, uint8 *Destination) const;
+    };
+
+    FBlockCompressedFileHandle(TUniquePtr<IFileHandle> &&InHandle, FBlockIndex &&InIndex);
+
+    /**
+     * Reads the header and sizes the block index accordingly. The caller fills in the offsets and then validates them.
+     */
+    static bool ParseHeader(const uint8 *Header, FBlockIndex &OutIndex);
+    static bool ValidateOffsets(const FBlockIndex &Index, int64 FileSize);
+
+    TUniquePtr<IFileHandle> Handle;
+    FBlockIndex Index;
+    int64 Position = 0;
+
+    TArray64<uint8> CompressedScratch;
+    TArray64<uint8> CachedBlock;
+    int32 CachedBlockIndex = INDEX_NONE;
+};
@@ -0,0 +1,49 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+/**
+ * Wraps another file handle with a read-ahead window and a write-behind buffer, so that many small reads and writes
+ * coming from managed serializers turn into a handful of large operations on the underlying handle. The wrapper tracks
+ * its own logical position, so Tell/Seek/Size always reflect buffered data that has not reached the inner handle yet.
+ *
+ * The size of the file is read once when the handle is opened and then kept up to date by the handle's own writes, so
+ * the file must not be resized through any other handle while this one is open.
+ */
+class POKESHARPCORE_API FBufferedFileHandle final : public IFileHandle
+{
+  public:
+    static constexpr int32 DefaultBufferSize = 64 * 1024;
+
+    explicit FBufferedFileHandle(TUniquePtr<IFileHandle> &&InHandle, int32 InBufferSize = DefaultBufferSize);
+    ~FBufferedFileHandle() override;
+
+    int64 Tell() override;
+    bool Seek(int64 NewPosition) override;
+    bool SeekFromEnd(int64 NewPositionRelativeToEnd = 0) override;
+    bool Read(uint8 *Destination, int64 BytesToRead) override;
+    bool Write(const uint8 *Source, int64 BytesToWrite) override;
+    bool Flush(bool bFullFlush = false) override;
+    bool Truncate(int64 NewSize) override;
+    int64 Size() override;
+    void ShrinkBuffers() override;
+
+  private:
+    bool FlushWriteBuffer();
+    void DiscardReadBuffer();
+    bool FillReadBuffer();
+
+    TUniquePtr<IFileHandle> Handle;
+    int32 BufferSize;
+    int64 Position = 0;
+    int64 FileSize = 0;
+
+    TArray<uint8> ReadBuffer;
+    int64 ReadBufferOffset = 0;
+
+    TArray<uint8> WriteBuffer;
+    int64 WriteBufferOffset = 0;
+};
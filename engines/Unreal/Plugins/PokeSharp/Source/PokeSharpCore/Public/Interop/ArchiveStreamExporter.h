@@ -9,6 +9,7 @@
 #include "ArchiveStreamExporter.generated.h"
 
 class FArchiveStream;
+class IFileHandle;
 enum class ESeekOrigin;
 
 /**
@@ -55,4 +56,24 @@ class POKESHARPCORE_API UArchiveStreamExporter : public UObject
 
     UNREALSHARP_FUNCTION()
     static bool Write(FArchive &Archive, uint8 *Buffer, int32 Size);
+
+    /**
+     * Copies data from one archive into another entirely on the native side, through a reusable buffer.
+     * @param Source The archive to read from, starting at its current position
+     * @param Destination The archive to write to
+     * @param Length The number of bytes to copy, or a negative value to copy everything up to the end of the source
+     * @return The number of bytes copied, or INDEX_NONE if the copy failed
+     */
+    UNREALSHARP_FUNCTION()
+    static int64 CopyTo(FArchive &Source, FArchive &Destination, int64 Length = INDEX_NONE);
+
+    /**
+     * Copies data from an archive into a file handle entirely on the native side, through a reusable buffer.
+     * @param Source The archive to read from, starting at its current position
+     * @param Destination The file handle to write to
+     * @param Length The number of bytes to copy, or a negative value to copy everything up to the end of the source
+     * @return The number of bytes copied, or INDEX_NONE if the copy failed
+     */
+    UNREALSHARP_FUNCTION()
+    static int64 CopyToFileHandle(FArchive &Source, IFileHandle *Destination, int64 Length = INDEX_NONE);
 };
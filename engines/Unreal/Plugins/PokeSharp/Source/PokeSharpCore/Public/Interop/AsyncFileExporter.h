@@ -0,0 +1,91 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "CSManagedDelegate.h"
+#include "CSManagedGCHandle.h"
+#include "UObject/Object.h"
+#include <atomic>
+
+#include "AsyncFileExporter.generated.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+/**
+ * An in-flight asynchronous file request. The managed callback is invoked once the request completes (or is
+ * cancelled), after which the managed side calls UAsyncFileExporter::Finish to collect the result and free the request.
+ */
+struct FPokeSharpAsyncFileRequest
+{
+    UE_NONCOPYABLE(FPokeSharpAsyncFileRequest)
+
+    explicit FPokeSharpAsyncFileRequest(const FGCHandle &Delegate) : Delegate(Delegate)
+    {
+    }
+
+    ~FPokeSharpAsyncFileRequest();
+
+    void OnCompleted(bool bWasCancelled, IAsyncReadRequest *CompletedRequest);
+
+    /**
+     * Stores the request returned by the file handle. The completion callback may fire before the handle returns, so
+     * the managed side is only signalled once both have happened.
+     */
+    void Publish(IAsyncReadRequest *IssuedRequest);
+
+    std::atomic<IAsyncReadRequest *> Request = nullptr;
+    bool bSizeRequest = false;
+    std::atomic<bool> bSucceeded = false;
+    std::atomic<int64> Result = 0;
+
+  private:
+    void Signal();
+
+    FCSManagedDelegate Delegate;
+
+    /**
+     * Counts down the completion callback and the request being published.
+     */
+    std::atomic<int32> PendingSignals = 2;
+};
+
+/**
+ * Exposes completion-based reads through IAsyncReadFileHandle, allowing managed code to await file I/O instead of
+ * blocking the calling thread.
+ */
+UCLASS()
+class POKESHARPCORE_API UAsyncFileExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    UNREALSHARP_FUNCTION()
+    static IAsyncReadFileHandle *OpenRead(const TCHAR *FileName);
+
+    UNREALSHARP_FUNCTION()
+    static FPokeSharpAsyncFileRequest *RequestSize(IAsyncReadFileHandle *Handle, FGCHandleIntPtr Callback);
+
+    /**
+     * Issues a ranged read into the supplied buffer, which must remain pinned until the request is finished. When
+     * bPrecache is set, the range is only loaded into the platform cache and the buffer is ignored.
+     */
+    UNREALSHARP_FUNCTION()
+    static FPokeSharpAsyncFileRequest *RequestRead(IAsyncReadFileHandle *Handle,
+                                                   int64 Offset,
+                                                   int64 Size,
+                                                   uint8 *Buffer,
+                                                   bool bPrecache,
+                                                   FGCHandleIntPtr Callback);
+
+    UNREALSHARP_FUNCTION()
+    static void Cancel(FPokeSharpAsyncFileRequest *Request);
+
+    UNREALSHARP_FUNCTION()
+    static bool Finish(FPokeSharpAsyncFileRequest *Request, int64 &OutResult);
+
+    UNREALSHARP_FUNCTION()
+    static void Close(const IAsyncReadFileHandle *Handle);
+};
@@ -0,0 +1,33 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "UObject/Object.h"
+
+#include "DataArchiveExporter.generated.h"
+
+class FPokeSharpDataArchive;
+
+/**
+ *
+ */
+UCLASS()
+class POKESHARPCORE_API UDataArchiveExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    UNREALSHARP_FUNCTION()
+    static bool Open(const TCHAR *FileName, TSharedPtr<FPokeSharpDataArchive> &OutArchive);
+
+    UNREALSHARP_FUNCTION()
+    static void Release(TSharedPtr<FPokeSharpDataArchive> &Archive);
+
+    UNREALSHARP_FUNCTION()
+    static bool Contains(const FPokeSharpDataArchive &Archive, const UTF16CHAR *Name, int32 Length);
+
+    UNREALSHARP_FUNCTION()
+    static IFileHandle *OpenEntry(FPokeSharpDataArchive &Archive, const UTF16CHAR *Name, int32 Length);
+};
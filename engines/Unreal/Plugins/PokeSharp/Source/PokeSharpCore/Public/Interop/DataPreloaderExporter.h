@@ -0,0 +1,29 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "UObject/Object.h"
+
+#include "DataPreloaderExporter.generated.h"
+
+/**
+ * Lets managed data loaders claim the buffers read ahead of time by FPokeSharpDataPreloader. Files are identified by
+ * their content path, such as /Game/Data/Species.pkdata.
+ */
+UCLASS()
+class POKESHARPCORE_API UDataPreloaderExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    UNREALSHARP_FUNCTION()
+    static TArray64<uint8> *Claim(const UTF16CHAR *FilePath, int32 Length, const uint8 *&OutData, int64 &OutSize);
+
+    UNREALSHARP_FUNCTION()
+    static void Release(const TArray64<uint8> *Buffer);
+
+    UNREALSHARP_FUNCTION()
+    static void Discard(const UTF16CHAR *FilePath, int32 Length);
+};
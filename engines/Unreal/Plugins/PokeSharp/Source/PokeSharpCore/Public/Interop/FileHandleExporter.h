@@ -15,6 +15,17 @@ enum class ESeekOrigin : int32
     End = 2
 };
 
+/**
+ * Describes a single range of a batched read or write. Matches the layout of the managed FileIOVector struct.
+ */
+struct FFileIOVector
+{
+    int64 Offset;
+    uint8 *Buffer;
+    int64 Length;
+    int64 BytesTransferred;
+};
+
 /**
  *
  */
@@ -47,4 +58,20 @@ class POKESHARPCORE_API UFileHandleExporter : public UObject
 
     UNREALSHARP_FUNCTION()
     static void Close(const IFileHandle *Handle);
+
+    /**
+     * Reads every range described by Vectors in a single call. Ranges that are adjacent in the file are coalesced into
+     * one read on the underlying handle. The handle's position is left unchanged.
+     * @return True if every range was filled completely
+     */
+    UNREALSHARP_FUNCTION()
+    static bool ReadVector(IFileHandle *Handle, FFileIOVector *Vectors, int32 Count);
+
+    /**
+     * Writes every range described by Vectors in a single call. Ranges that are adjacent in the file are coalesced into
+     * one write on the underlying handle. The handle's position is left unchanged.
+     * @return True if every range was written
+     */
+    UNREALSHARP_FUNCTION()
+    static bool WriteVector(IFileHandle *Handle, FFileIOVector *Vectors, int32 Count);
 };
@@ -0,0 +1,39 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "UObject/Object.h"
+
+#include "MappedFileExporter.generated.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * A read-only memory mapping of an entire file, keeping both the file handle and the mapped region alive for as long
+ * as managed code holds onto it.
+ */
+struct FPokeSharpMappedFile
+{
+    TUniquePtr<IMappedFileHandle> Handle;
+    TUniquePtr<IMappedFileRegion> Region;
+};
+
+/**
+ * Exposes memory-mapped file access to managed code, allowing data files to be deserialized directly from the mapped
+ * pages rather than being copied through a file handle one chunk at a time.
+ */
+UCLASS()
+class POKESHARPCORE_API UMappedFileExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    UNREALSHARP_FUNCTION()
+    static FPokeSharpMappedFile *Open(const TCHAR *FileName, const uint8 *&OutData, int64 &OutSize);
+
+    UNREALSHARP_FUNCTION()
+    static void Close(const FPokeSharpMappedFile *MappedFile);
+};
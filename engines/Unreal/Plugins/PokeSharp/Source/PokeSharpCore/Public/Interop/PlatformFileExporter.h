@@ -17,15 +17,40 @@ class POKESHARPCORE_API UPlatformFileExporter : public UObject
     GENERATED_BODY()
 
   public:
+    /**
+     * Opens a file for reading.
+     * @param FileName The package path of the file to open
+     * @param bAllowWrite Whether the file may also be written to
+     * @param BufferSize The size of the read-ahead/write-behind buffer placed in front of the handle, or 0 to disable
+     * buffering
+     * @return The opened handle, or nullptr if the file could not be opened
+     */
     UNREALSHARP_FUNCTION()
-    static IFileHandle *OpenRead(const TCHAR *FileName, bool bAllowWrite = false);
+    static IFileHandle *OpenRead(const TCHAR *FileName, bool bAllowWrite = false, int32 BufferSize = 0);
 
     UNREALSHARP_FUNCTION()
     static IFileHandle *OpenWrite(const TCHAR *FileName,
                                   bool bAppend = false,
                                   bool bAllowRead = false,
-                                  bool bOverwrite = true);
+                                  bool bOverwrite = true,
+                                  int32 BufferSize = 0);
 
-  private:
+    /**
+     * Checks if a file is stored in the block-compressed data format. Such files are transparently decompressed by
+     * OpenRead, but cannot be read through the asynchronous or memory-mapped paths.
+     * @param FileName The package path of the file to check
+     * @return Whether the file exists and is block-compressed
+     */
+    UNREALSHARP_FUNCTION()
+    static bool IsBlockCompressed(const TCHAR *FileName);
+
+    /**
+     * Converts a long package path (e.g. /Game/Data/species.pkdata) into an absolute path on disk.
+     * @param FileName The package path to convert
+     * @return The absolute path, or an empty string if the path could not be converted
+     */
     static FString ConvertToContentDirPath(const TCHAR *FileName);
+
+  private:
+    static IFileHandle *WrapHandle(IFileHandle *Handle, int32 BufferSize);
 };
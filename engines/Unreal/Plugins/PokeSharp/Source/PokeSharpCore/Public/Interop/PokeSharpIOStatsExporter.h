@@ -0,0 +1,31 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "UObject/Object.h"
+
+#include "PokeSharpIOStatsExporter.generated.h"
+
+struct FPokeSharpIOSnapshot;
+enum class EPokeSharpIOSource : uint8;
+
+/**
+ * Exposes the I/O counters collected by FPokeSharpIOStats to managed code.
+ */
+UCLASS()
+class POKESHARPCORE_API UPokeSharpIOStatsExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    UNREALSHARP_FUNCTION()
+    static void GetSnapshot(EPokeSharpIOSource Source, FPokeSharpIOSnapshot &OutSnapshot);
+
+    UNREALSHARP_FUNCTION()
+    static bool GetHandleSnapshot(const void *Handle, FPokeSharpIOSnapshot &OutSnapshot);
+
+    UNREALSHARP_FUNCTION()
+    static void Reset();
+};
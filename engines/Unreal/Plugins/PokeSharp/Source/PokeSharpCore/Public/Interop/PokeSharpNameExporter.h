@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "CSBindsManager.h"
+#include "Strings/PokeSharpNameDisplayTable.h"
 #include "UObject/Object.h"
 
 #include "PokeSharpNameExporter.generated.h"
@@ -25,6 +26,37 @@ class POKESHARPCORE_API UPokeSharpNameExporter : public UObject
                               uint32 &DisplayIndex,
                               int32 &Number);
 
+    /**
+     * Gets or adds the entries for a batch of names packed back to back into a single UTF-16 buffer.
+     * @param Buffer The characters of every name
+     * @param Offsets Count + 1 offsets into Buffer, where name i spans [Offsets[i], Offsets[i + 1])
+     * @param Count The number of names in the batch
+     * @param FindMode If true, names that do not already exist are not added
+     * @param ComparisonIndices Receives the comparison index of each name
+     * @param DisplayIndices Receives the display index of each name
+     * @param Numbers Receives the number of each name
+     */
+    UNREALSHARP_FUNCTION()
+    static void GetOrAddEntries(const UTF16CHAR *Buffer,
+                                const int32 *Offsets,
+                                int32 Count,
+                                bool FindMode,
+                                uint32 *ComparisonIndices,
+                                uint32 *DisplayIndices,
+                                int32 *Numbers);
+
+    /**
+     * UTF-8 variant of GetOrAddEntries, which lets serialized string bytes be interned without transcoding them first.
+     */
+    UNREALSHARP_FUNCTION()
+    static void GetOrAddEntriesUtf8(const UTF8CHAR *Buffer,
+                                    const int32 *Offsets,
+                                    int32 Count,
+                                    bool FindMode,
+                                    uint32 *ComparisonIndices,
+                                    uint32 *DisplayIndices,
+                                    int32 *Numbers);
+
     UNREALSHARP_FUNCTION()
     static bool IsValid(uint32 ComparisonIndex, uint32 DisplayIndex);
 
@@ -38,6 +70,22 @@ class POKESHARPCORE_API UPokeSharpNameExporter : public UObject
     UNREALSHARP_FUNCTION()
     static void GetString(uint32 ComparisonIndex, uint32 DisplayIndex, int32 Number, FString &OutString);
 
+    /**
+     * Copies the characters stored in a name's display entry into a caller-provided buffer, without building an
+     * FString. ANSI entries are copied as single bytes and left for the caller to widen.
+     * @param Buffer Receives the characters of the entry. Must hold at least NAME_SIZE wide characters.
+     * @param bOutWide Set to true if the entry stores wide characters
+     * @return The number of characters in the entry, not including the number suffix
+     */
+    UNREALSHARP_FUNCTION()
+    static int32 GetPlainName(uint32 ComparisonIndex, uint32 DisplayIndex, uint8 *Buffer, bool &bOutWide);
+
+    /**
+     * Describes the display table, which holds the display string of every name returned by this exporter.
+     */
+    UNREALSHARP_FUNCTION()
+    static void GetDisplayTable(FPokeSharpNameDisplayTableView &OutView);
+
     UNREALSHARP_FUNCTION()
     static void FromUnrealName(FName Name, uint32 &ComparisonIndex, uint32 &DisplayIndex, int32 &Number);
 
@@ -23,4 +23,13 @@ class POKESHARPCORE_API UPokeSharpSaveGameExporter : public UObject
 
     UNREALSHARP_FUNCTION()
     static void WriteToDataBuffer(UPokeSharpSaveGame *SaveGame, const uint8 *Buffer, int32 Size);
+
+    UNREALSHARP_FUNCTION()
+    static void ReserveDataBuffer(UPokeSharpSaveGame *SaveGame, int32 Capacity);
+
+    UNREALSHARP_FUNCTION()
+    static void GetWriteSpan(UPokeSharpSaveGame *SaveGame, int32 MinSize, uint8 *&OutBuffer, int32 &OutSize);
+
+    UNREALSHARP_FUNCTION()
+    static bool CommitWrite(UPokeSharpSaveGame *SaveGame, int32 Bytes);
 };
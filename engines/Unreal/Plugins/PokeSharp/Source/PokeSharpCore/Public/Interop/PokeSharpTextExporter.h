@@ -32,6 +32,40 @@ class POKESHARPCORE_API UPokeSharpTextExporter : public UObject
     UNREALSHARP_FUNCTION()
     static void FromLocText(const TCHAR *StrBuffer, int32 StrLength, FText &OutText);
 
+    /**
+     * Resolves a batch of localized texts that share a namespace, such as every string of a dialogue, in one call.
+     * @param KeyOffsets Count + 1 offsets into KeysBuffer, where key i spans [KeyOffsets[i], KeyOffsets[i + 1])
+     * @param SourceOffsets Count + 1 offsets into SourcesBuffer, laid out the same way as KeyOffsets
+     * @param OutHandles Receives the cache handle of each text. May be null.
+     * @param OutTexts Receives each text. May be null.
+     */
+    UNREALSHARP_FUNCTION()
+    static void FromLocalizedBatch(const UTF16CHAR *NamespaceBuffer,
+                                   int32 NamespaceLength,
+                                   const UTF16CHAR *KeysBuffer,
+                                   const int32 *KeyOffsets,
+                                   const UTF16CHAR *SourcesBuffer,
+                                   const int32 *SourceOffsets,
+                                   int32 Count,
+                                   int32 *OutHandles,
+                                   FText *OutTexts);
+
+    UNREALSHARP_FUNCTION()
+    static void FromStringTable(FName TableId, const UTF16CHAR *KeyBuffer, int32 KeyLength, FText &OutText);
+
+    /**
+     * Caches every entry of a registered string table, so later lookups into it only copy a shared reference.
+     * @return The number of entries in the table
+     */
+    UNREALSHARP_FUNCTION()
+    static int32 PreloadStringTable(FName TableId);
+
+    UNREALSHARP_FUNCTION()
+    static bool FromHandle(int32 Handle, FText &OutText);
+
+    UNREALSHARP_FUNCTION()
+    static const uint32 *GetCultureGeneration();
+
     UNREALSHARP_FUNCTION()
     static void ToLocText(const FText &Text, FString &OutStr);
 
@@ -65,6 +99,40 @@ class POKESHARPCORE_API UPokeSharpTextExporter : public UObject
     UNREALSHARP_FUNCTION()
     static void Destroy(FText &Text);
 
+    /**
+     * Gets the characters of the current display string. They are only valid until the culture changes, so use
+     * PinDisplayString to hold onto them for longer.
+     */
     UNREALSHARP_FUNCTION()
     static void AsDisplaySpan(const FText &Text, const TCHAR *&OutBuffer, int32 &OutLength);
+
+    /**
+     * Gets the characters of the current display string along with a shared reference to it, which keeps them valid
+     * even if the culture changes until UnpinDisplayString is called.
+     * @param OutPin Uninitialized memory that receives the reference
+     */
+    UNREALSHARP_FUNCTION()
+    static void PinDisplayString(const FText &Text,
+                                 FTextConstDisplayStringPtr &OutPin,
+                                 const TCHAR *&OutBuffer,
+                                 int32 &OutLength);
+
+    UNREALSHARP_FUNCTION()
+    static void UnpinDisplayString(FTextConstDisplayStringPtr &Pin);
+
+    /**
+     * Pins the display strings of a batch of texts, such as every line of a menu, in one call.
+     * @param OutPins Count slots of uninitialized memory that receive the references
+     * @param OutBuffers Receives the characters of each display string
+     * @param OutLengths Receives the length of each display string
+     */
+    UNREALSHARP_FUNCTION()
+    static void PinDisplayStrings(const FText *Texts,
+                                  int32 Count,
+                                  FTextConstDisplayStringPtr *OutPins,
+                                  const TCHAR **OutBuffers,
+                                  int32 *OutLengths);
+
+    UNREALSHARP_FUNCTION()
+    static void UnpinDisplayStrings(FTextConstDisplayStringPtr *Pins, int32 Count);
 };
@@ -0,0 +1,128 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "CSManagedDelegate.h"
+#include "CSManagedGCHandle.h"
+#include "Saving/PokeSharpSavePipeline.h"
+#include "UObject/Object.h"
+#include <atomic>
+
+#include "SavePipelineExporter.generated.h"
+
+class FPokeSharpSaveContainer;
+
+/**
+ * A save being assembled by managed code and then written by the save pipeline. Both managed callbacks are invoked
+ * from worker threads, after which the managed side calls USavePipelineExporter::Finish to free the request.
+ */
+struct FPokeSharpSaveRequest
+{
+    UE_NONCOPYABLE(FPokeSharpSaveRequest)
+
+    FPokeSharpSaveRequest(const FGCHandle &InProgressDelegate, const FGCHandle &InCompletionDelegate);
+
+    ~FPokeSharpSaveRequest();
+
+    TSharedRef<FPokeSharpSaveSnapshot> Snapshot;
+    std::atomic<float> Progress = 0.0f;
+    std::atomic<EPokeSharpSaveResult> Result = EPokeSharpSaveResult::Failed;
+
+    FCSManagedDelegate ProgressDelegate;
+    FCSManagedDelegate CompletionDelegate;
+};
+
+/**
+ * Exposes the background save pipeline and the save containers it writes.
+ */
+UCLASS()
+class POKESHARPCORE_API USavePipelineExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    /**
+     * Checks whether the platform can hold save containers at all, see FPokeSharpSaveContainer::IsSupported.
+     */
+    UNREALSHARP_FUNCTION()
+    static bool IsContainerSupported();
+
+    UNREALSHARP_FUNCTION()
+    static FPokeSharpSaveRequest *CreateRequest(FGCHandleIntPtr ProgressCallback, FGCHandleIntPtr CompletionCallback);
+
+    /**
+     * Copies a serialized section into the request's snapshot, so the managed buffer can be reused straight away.
+     */
+    UNREALSHARP_FUNCTION()
+    static void AddSection(FPokeSharpSaveRequest *Request,
+                           const UTF16CHAR *Name,
+                           int32 NameLength,
+                           const uint8 *Data,
+                           int64 Size);
+
+    /**
+     * Sets the slot summary stored at the start of the container, replacing any party icons added so far.
+     */
+    UNREALSHARP_FUNCTION()
+    static void SetSummary(FPokeSharpSaveRequest *Request,
+                           const UTF16CHAR *PlayerName,
+                           int32 PlayerNameLength,
+                           double PlayTimeSeconds,
+                           int64 Badges,
+                           int64 TimestampTicks,
+                           const UTF16CHAR *GameVersion,
+                           int32 GameVersionLength);
+
+    /**
+     * Adds a party member to the summary set by SetSummary.
+     */
+    UNREALSHARP_FUNCTION()
+    static void AddPartyIcon(FPokeSharpSaveRequest *Request,
+                             const UTF16CHAR *Species,
+                             int32 SpeciesLength,
+                             int32 Form,
+                             bool bShiny,
+                             bool bFemale,
+                             bool bEgg);
+
+    /**
+     * Hands the request to the save pipeline. When bKeepUnwrittenSections is set, sections already in the slot that
+     * were not added to the request are kept rather than removed, and Finish reports NothingToUpdate if there are none.
+     */
+    UNREALSHARP_FUNCTION()
+    static void Submit(FPokeSharpSaveRequest *Request, const TCHAR *SlotName, bool bKeepUnwrittenSections);
+
+    UNREALSHARP_FUNCTION()
+    static float GetProgress(const FPokeSharpSaveRequest *Request);
+
+    UNREALSHARP_FUNCTION()
+    static EPokeSharpSaveResult Finish(FPokeSharpSaveRequest *Request);
+
+    /**
+     * Opens the save container in a slot, waiting for any save to that slot that is still being written.
+     */
+    UNREALSHARP_FUNCTION()
+    static bool OpenContainer(const TCHAR *SlotName, TSharedPtr<FPokeSharpSaveContainer> &OutContainer);
+
+    UNREALSHARP_FUNCTION()
+    static void ReleaseContainer(TSharedPtr<FPokeSharpSaveContainer> &Container);
+
+    UNREALSHARP_FUNCTION()
+    static int32 GetSectionCount(const FPokeSharpSaveContainer &Container);
+
+    UNREALSHARP_FUNCTION()
+    static void GetSectionInfo(const FPokeSharpSaveContainer &Container,
+                               int32 Index,
+                               const TCHAR *&OutName,
+                               int32 &OutNameLength,
+                               int64 &OutSize);
+
+    UNREALSHARP_FUNCTION()
+    static bool ReadSection(FPokeSharpSaveContainer &Container,
+                            const UTF16CHAR *Name,
+                            int32 NameLength,
+                            uint8 *Buffer,
+                            int64 BufferSize);
+};
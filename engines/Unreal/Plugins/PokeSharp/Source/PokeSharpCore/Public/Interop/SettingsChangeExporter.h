@@ -26,4 +26,11 @@ class POKESHARPCORE_API USettingsChangeExporter : public UObject
 
     UNREALSHARP_FUNCTION()
     static void UnregisterSettingsChangeCallback(const FGuid &Guid);
+
+    /**
+     * Gets the names of the properties that changed for the callback that is currently running. The names are only
+     * valid until the callback returns.
+     */
+    UNREALSHARP_FUNCTION()
+    static void GetChangedProperties(const FName *&OutProperties, int32 &OutCount);
 };
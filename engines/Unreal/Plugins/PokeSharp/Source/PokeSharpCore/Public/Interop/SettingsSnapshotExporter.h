@@ -0,0 +1,31 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "UObject/Object.h"
+
+#include "SettingsSnapshotExporter.generated.h"
+
+class UDeveloperSettings;
+
+/**
+ *
+ */
+UCLASS()
+class POKESHARPCORE_API USettingsSnapshotExporter : public UObject
+{
+    GENERATED_BODY()
+
+  public:
+    /**
+     * Writes every config property of a settings object into a single MessagePack blob.
+     * @param OutBuffer Receives the blob. Must be released with ReleaseSnapshot.
+     */
+    UNREALSHARP_FUNCTION()
+    static void TakeSnapshot(const UDeveloperSettings *Settings, TArray<uint8> &OutBuffer);
+
+    UNREALSHARP_FUNCTION()
+    static void ReleaseSnapshot(TArray<uint8> &Buffer);
+};
@@ -0,0 +1,140 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/PokeSharpDataArchive.h"
+
+class IFileHandle;
+struct FPokeSharpSaveSlotSummary;
+
+/**
+ * A single entry in the section directory of a save container.
+ */
+struct FPokeSharpSaveSectionEntry
+{
+    FString Name;
+    int64 Offset = 0;
+    int64 Size = 0;
+    int64 UncompressedSize = 0;
+    uint32 Crc = 0;
+    uint64 Hash = 0;
+    EPokeSharpDataCompression Compression = EPokeSharpDataCompression::None;
+
+    /**
+     * Checks whether the section holds the same uncompressed contents as another, going by size and hash.
+     */
+    bool HasSameContents(const FPokeSharpSaveSectionEntry &Other) const
+    {
+        return Hash == Other.Hash && UncompressedSize == Other.UncompressedSize;
+    }
+};
+
+/**
+ * A save slot stored as independent sections, one per managed save value, instead of as a serialized USaveGame.
+ * Containers live at the same path the generic save game system uses, so slots in either format can sit side by side
+ * and are told apart by their magic. Platforms with their own save game system keep their slots somewhere else, so
+ * they never use containers at all.
+ *
+ * Sections can be replaced without rewriting the whole file: changed sections and a new directory are appended to the
+ * end, and only then is the header updated to point at the new directory. Until that final write the old directory
+ * is still intact, so an interrupted update leaves the previous save readable.
+ *
+ * Layout (little-endian):
+ *  - Header: uint32 Magic ('PKSV'), uint32 Version, uint32 SectionCount, uint32 DirectorySize, int64 DirectoryOffset,
+ *    uint32 DirectoryCrc, padded to 32 bytes
+ *  - Slot summary: uint8 bHasSummary, uint8 PartyCount, padded to 8 bytes, int64 Timestamp (UTC ticks), double
+ *    PlayTime (seconds), uint64 Badges, UTF-16 PlayerName[24], UTF-8 GameVersion[24], then per party member UTF-8
+ *    Species[20], uint8 Form, uint8 Flags, padded to 4 bytes, all padded to 256 bytes
+ *  - The stored bytes of every section, along with any stale sections left behind by updates
+ *  - Directory, per section: uint16 NameLength, UTF-8 Name, uint8 Compression, int64 Offset, int64 Size,
+ *    int64 UncompressedSize, uint32 Crc32 (of the stored bytes), uint64 CityHash64 (of the uncompressed bytes)
+ */
+class POKESHARPCORE_API FPokeSharpSaveContainer
+{
+  public:
+    static constexpr uint32 Magic = 0x56534B50;
+    static constexpr uint32 Version = 1;
+    static constexpr int64 HeaderSize = 32;
+    static constexpr int64 SummarySize = 256;
+    static constexpr int64 DataOffset = HeaderSize + SummarySize;
+    static constexpr int32 MaxPartySize = 6;
+
+    /**
+     * Checks whether the platform uses the generic save game system, which keeps every slot as a plain file at
+     * GetSlotPath. Containers bypass the save game system, so they can only be used when that is where it looks too.
+     */
+    static bool IsSupported();
+
+    /**
+     * Gets the absolute path of the file backing a save slot.
+     */
+    static FString GetSlotPath(FStringView SlotName);
+
+    /**
+     * Writes the header of a container.
+     */
+    static void WriteHeader(FArchive &Ar, int32 SectionCount, int64 DirectoryOffset, TConstArrayView<uint8> Directory);
+
+    /**
+     * Writes the slot summary block, or an empty one if there is no summary.
+     */
+    static void WriteSummary(FArchive &Ar, const FPokeSharpSaveSlotSummary *Summary);
+
+    /**
+     * Reads the slot summary of a container, touching only the first few hundred bytes of the file.
+     * @param Handle A handle to the container file
+     * @param OutSummary Receives the summary
+     * @return Whether the file holds a container with a summary
+     */
+    static bool ReadSummary(IFileHandle &Handle, FPokeSharpSaveSlotSummary &OutSummary);
+
+    /**
+     * Serializes a section directory into its on-disk form.
+     */
+    static TArray<uint8> WriteDirectory(TConstArrayView<FPokeSharpSaveSectionEntry> Entries);
+
+    /**
+     * Hashes the uncompressed contents of a section.
+     */
+    static uint64 HashSection(TConstArrayView64<uint8> Data);
+
+    /**
+     * Reads the header and section directory of a container without touching any of the section data.
+     * @param Handle A handle to the container file
+     * @param OutSections Receives the section directory
+     * @return Whether the file holds a valid container
+     */
+    static bool ReadDirectory(IFileHandle &Handle, TArray<FPokeSharpSaveSectionEntry> &OutSections);
+
+    ~FPokeSharpSaveContainer();
+
+    /**
+     * Opens the container stored in a save slot and reads its section directory. The container keeps the file open,
+     * and sections are only read from it once they are asked for.
+     * @param SlotName The name of the save slot
+     * @return The opened container, or nullptr if the slot does not exist or does not hold a container
+     */
+    static TSharedPtr<FPokeSharpSaveContainer> Open(FStringView SlotName);
+
+    TConstArrayView<FPokeSharpSaveSectionEntry> GetSections() const
+    {
+        return Sections;
+    }
+
+    const FPokeSharpSaveSectionEntry *FindSection(FStringView Name) const;
+
+    /**
+     * Reads, verifies and inflates a single section into the given buffer. Safe to call from multiple threads.
+     * @param Name The name of the section
+     * @param Destination The buffer to write into, which must hold at least the section's uncompressed size
+     * @return Whether the section exists and passed its checksum
+     */
+    bool ReadSection(FStringView Name, TArrayView64<uint8> Destination);
+
+  private:
+    FString SlotPath;
+    TUniquePtr<IFileHandle> Handle;
+    FCriticalSection HandleLock;
+    TArray<FPokeSharpSaveSectionEntry> Sections;
+};
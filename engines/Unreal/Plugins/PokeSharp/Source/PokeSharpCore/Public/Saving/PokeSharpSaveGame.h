@@ -8,7 +8,8 @@
 #include "PokeSharpSaveGame.generated.h"
 
 /**
- *
+ * A save game holding the serialized managed save data. The data is written compressed after the object's tagged
+ * properties, followed by a CRC32 of the uncompressed bytes that is checked when the save is loaded.
  */
 UCLASS()
 class POKESHARPCORE_API UPokeSharpSaveGame : public USaveGame
@@ -19,6 +20,18 @@ class POKESHARPCORE_API UPokeSharpSaveGame : public USaveGame
     UFUNCTION(meta = (ScriptMethod))
     static UPokeSharpSaveGame *CreateSaveGame();
 
+    void Serialize(FArchive &Ar) override;
+
+    /**
+     * Checks whether the data failed its checksum or could not be inflated when the save was loaded, in which case
+     * the data is left empty.
+     */
+    UFUNCTION(meta = (ScriptMethod))
+    bool IsCorrupt() const
+    {
+        return bCorrupt;
+    }
+
     TConstArrayView<uint8> GetData() const
     {
         return Data;
@@ -35,7 +48,29 @@ class POKESHARPCORE_API UPokeSharpSaveGame : public USaveGame
 
     void WriteData(TConstArrayView<uint8> Buffer);
 
+    /**
+     * Makes sure the data buffer can hold at least the given number of bytes without reallocating. Typically called
+     * with the size of the previous save before serialization starts.
+     */
+    void ReserveData(int32 Capacity);
+
+    /**
+     * Gets a writable view over the unused capacity at the end of the data buffer, growing it if there are fewer than
+     * MinSize bytes available. Nothing is added to the data until CommitData is called.
+     */
+    TArrayView<uint8> GetWriteSpan(int32 MinSize);
+
+    /**
+     * Appends the given number of bytes that were written into the span returned by GetWriteSpan.
+     */
+    bool CommitData(int32 Bytes);
+
   private:
+    void WriteCompressedData(FArchive &Ar) const;
+    void ReadCompressedData(FArchive &Ar);
+
     UPROPERTY()
     TArray<uint8> Data;
+
+    bool bCorrupt = false;
 };
@@ -0,0 +1,117 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Saving/PokeSharpSaveSlotIndex.h"
+#include "Tasks/Task.h"
+
+/**
+ * A copy of every serialized section of a save, taken on the game thread. Once submitted the snapshot is only ever
+ * read, so the worker threads can use it without any further synchronization.
+ */
+struct FPokeSharpSaveSnapshot
+{
+    struct FSection
+    {
+        FString Name;
+        TArray64<uint8> Data;
+    };
+
+    void AddSection(FString &&Name, TConstArrayView64<uint8> Data);
+
+    TArray<FSection> Sections;
+
+    /**
+     * The summary to store at the start of the container. Left unset, the slot keeps whatever summary it already had.
+     */
+    TOptional<FPokeSharpSaveSlotSummary> Summary;
+};
+
+/**
+ * How a snapshot is applied to the save container already in its slot.
+ */
+enum class EPokeSharpSaveMode : uint8
+{
+    /**
+     * The snapshot holds the whole save, so sections missing from it are dropped from the slot.
+     */
+    Replace,
+
+    /**
+     * The snapshot only holds the sections being replaced, every other section in the slot is kept. Nothing is written
+     * if the slot does not hold a readable container, rather than leaving only the replaced sections behind.
+     */
+    Update
+};
+
+/**
+ * The outcome of a save written by the pipeline.
+ */
+enum class EPokeSharpSaveResult : uint8
+{
+    Succeeded,
+    Failed,
+
+    /**
+     * An update found no readable container in the slot, so nothing was written and the whole save has to be submitted
+     * instead.
+     */
+    NothingToUpdate
+};
+
+/**
+ * Writes save snapshots into save containers on the task graph. Compression, checksumming and the write itself all
+ * happen off the game thread.
+ *
+ * Sections are hashed and compared against the container already in the slot, and only the ones that changed are
+ * compressed and appended to it. Once stale sections would make up most of the file, the container is compacted by
+ * writing a fresh copy to a temporary file that is then renamed over the slot. Either way a crash mid-write never
+ * leaves a truncated save behind.
+ */
+class POKESHARPCORE_API FPokeSharpSavePipeline
+{
+  public:
+    using FOnProgress = TFunction<void(float)>;
+    using FOnCompleted = TFunction<void(EPokeSharpSaveResult)>;
+
+    static FPokeSharpSavePipeline &Get();
+
+    /**
+     * Queues a snapshot to be written to a save slot. Saves to the same slot are written in the order they were
+     * submitted.
+     * @param SlotName The name of the save slot
+     * @param Snapshot The sections to write
+     * @param Mode How the snapshot is applied to the sections already in the slot
+     * @param OnProgress Invoked from a worker thread with the fraction of the save that has been processed
+     * @param OnCompleted Invoked from a worker thread once the save has been written, or has failed to
+     */
+    void Submit(const FString &SlotName,
+                TSharedRef<const FPokeSharpSaveSnapshot> Snapshot,
+                EPokeSharpSaveMode Mode,
+                FOnProgress &&OnProgress,
+                FOnCompleted &&OnCompleted);
+
+    /**
+     * Blocks until every save queued for the given slot has been written.
+     */
+    void WaitForSlot(FStringView SlotName);
+
+    /**
+     * Blocks until every queued save has been written.
+     */
+    void Flush();
+
+  private:
+    /**
+     * Drops the slots whose last save has finished. Must be called with the lock held.
+     */
+    void PruneCompletedSaves();
+
+    FCriticalSection Lock;
+
+    /**
+     * The last save submitted to each slot, which every later save to that slot waits on.
+     */
+    TMap<FString, UE::Tasks::FTask> PendingSaves;
+};
@@ -0,0 +1,119 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "UnrealSharpAsync/Public/CSAsyncActionBase.h"
+
+#include "PokeSharpSaveSlotIndex.generated.h"
+
+/**
+ * Enough information about a party member to draw its icon on the load screen.
+ */
+USTRUCT(BlueprintType)
+struct POKESHARPCORE_API FPokeSharpSavePartyIcon
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    FName Species;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    int32 Form = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    bool bShiny = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    bool bFemale = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    bool bEgg = false;
+};
+
+/**
+ * The fixed-size summary stored at the start of every save container, which can be read without touching the rest of
+ * the save.
+ */
+USTRUCT(BlueprintType)
+struct POKESHARPCORE_API FPokeSharpSaveSlotSummary
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    FString SlotName;
+
+    /**
+     * Whether the rest of the summary is filled in. Saves written through the USaveGame path only carry their slot
+     * name and timestamp.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    bool bHasDetails = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    FString PlayerName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    FTimespan PlayTime;
+
+    /**
+     * One bit per badge, in badge order.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    int64 Badges = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    TArray<FPokeSharpSavePartyIcon> Party;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    FDateTime Timestamp;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Game")
+    FString GameVersion;
+};
+
+/**
+ * Lists save slots by reading only the summary at the start of each one, so the load screen never has to load a
+ * whole save just to describe it.
+ */
+UCLASS()
+class POKESHARPCORE_API UPokeSharpSaveSlotIndex : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+  public:
+    /**
+     * Reads the summary of every save slot in parallel. Only saves still being written to one of the listed slots are
+     * waited on, a slot whose first save has not reached the disk yet is left out.
+     * @return The summaries, most recently saved first
+     */
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    static TArray<FPokeSharpSaveSlotSummary> GetSlotSummaries();
+
+    /**
+     * Reads the summary of a single save slot.
+     * @param SlotName The name of the save slot
+     * @param OutSummary Receives the summary
+     * @return Whether the slot exists
+     */
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    static bool GetSlotSummary(const FString &SlotName, FPokeSharpSaveSlotSummary &OutSummary);
+};
+
+/**
+ * Reads the save slot summaries on a worker thread.
+ */
+UCLASS(meta = (InternalType))
+class POKESHARPCORE_API UGetSaveSlotSummariesAsync : public UCSAsyncActionBase
+{
+    GENERATED_BODY()
+
+  public:
+    UFUNCTION(meta = (ScriptMethod))
+    void GetSlotSummaries();
+
+  private:
+    UPROPERTY()
+    TArray<FPokeSharpSaveSlotSummary> Summaries;
+};
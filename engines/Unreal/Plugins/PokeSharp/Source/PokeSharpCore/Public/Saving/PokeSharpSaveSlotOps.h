@@ -0,0 +1,48 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealSharpAsync/Public/CSAsyncActionBase.h"
+
+#include "PokeSharpSaveSlotOps.generated.h"
+
+/**
+ * Copies, renames and deletes save slots as raw bytes through the platform save system, on a worker thread. Nothing
+ * is deserialized, so it works the same for save containers and USaveGame slots. Saves still being written to either
+ * slot by the save pipeline are waited for first.
+ */
+UCLASS(meta = (InternalType))
+class POKESHARPCORE_API UPokeSharpSaveSlotOps : public UCSAsyncActionBase
+{
+    GENERATED_BODY()
+
+  public:
+    UFUNCTION(meta = (ScriptMethod))
+    void CopySlot(const FString &SourceSlotName, const FString &DestinationSlotName, int32 UserIndex);
+
+    /**
+     * Moves a slot to a new name. Platform save systems have no rename, so this is a copy followed by deleting the
+     * source, which is only deleted once the copy has been written.
+     */
+    UFUNCTION(meta = (ScriptMethod))
+    void RenameSlot(const FString &SourceSlotName, const FString &DestinationSlotName, int32 UserIndex);
+
+    UFUNCTION(meta = (ScriptMethod))
+    void DeleteSlot(const FString &SlotName, int32 UserIndex);
+
+    UFUNCTION(meta = (ScriptMethod))
+    static bool CopySlotBlocking(const FString &SourceSlotName, const FString &DestinationSlotName, int32 UserIndex);
+
+    UFUNCTION(meta = (ScriptMethod))
+    static bool RenameSlotBlocking(const FString &SourceSlotName, const FString &DestinationSlotName, int32 UserIndex);
+
+    UFUNCTION(meta = (ScriptMethod))
+    static bool DeleteSlotBlocking(const FString &SlotName, int32 UserIndex);
+
+  private:
+    void RunOnWorker(TUniqueFunction<bool()> &&Operation);
+
+    UPROPERTY()
+    bool bSucceeded = false;
+};
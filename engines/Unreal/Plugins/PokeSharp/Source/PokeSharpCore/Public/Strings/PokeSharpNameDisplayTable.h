@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Describes where the display table lives so managed code can read it directly. Matches the managed
+ * NameDisplayTableView struct.
+ */
+struct FPokeSharpNameDisplayTableView
+{
+    /**
+     * BlockCount pointers, one per FName pool block. Each is either null or points at 1 << OffsetBits entry pointers,
+     * and each entry pointer is either null or points at a uint16 length followed by that many UTF-16 characters.
+     */
+    const void *Blocks = nullptr;
+    const uint32 *Generation = nullptr;
+    uint32 BlockCount = 0;
+    int32 OffsetBits = 0;
+};
+
+/**
+ * An append-only copy of the display strings of every name that has been handed to managed code, laid out so it can
+ * be indexed by display index without calling back into native code. Entries are never moved or freed once they are
+ * published, so managed code may hold onto the characters for the lifetime of the process.
+ */
+class POKESHARPCORE_API FPokeSharpNameDisplayTable
+{
+  public:
+    static FPokeSharpNameDisplayTable &Get();
+
+    /**
+     * Makes sure the display string of the given name is in the table. Cheap and lock-free once it is.
+     */
+    void Register(FName Name);
+
+    void GetView(FPokeSharpNameDisplayTableView &OutView) const;
+
+  private:
+    using FSlot = std::atomic<const UTF16CHAR *>;
+
+    FPokeSharpNameDisplayTable() = default;
+
+    UTF16CHAR *AllocateEntry(int32 Length);
+
+    std::atomic<FSlot *> Blocks[FNameMaxBlocks] = {};
+
+    /**
+     * Bumped every time a new entry is published.
+     */
+    std::atomic<uint32> Generation = 0;
+
+    FCriticalSection WriteLock;
+    TArray<TUniquePtr<UTF16CHAR[]>> Chunks;
+    int32 ChunkUsed = 0;
+};
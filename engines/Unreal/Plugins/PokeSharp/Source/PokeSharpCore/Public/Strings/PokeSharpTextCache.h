@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Interns the FTexts that managed code builds, so asking for the same localized text again copies a shared reference
+ * instead of building a new FText and parsing its loc-text buffer. Every cached text gets a stable handle that can be
+ * used to fetch it again without any lookup.
+ *
+ * Only texts that carry a namespace and key are cached, since those come from a bounded set of authored strings.
+ * Cached texts keep following the active culture on their own; the culture generation only exists so that managed
+ * code knows when copies of their display strings have gone stale.
+ */
+class POKESHARPCORE_API FPokeSharpTextCache
+{
+  public:
+    static FPokeSharpTextCache &Get();
+
+    /**
+     * Finds or creates the text with the given namespace, key and source string. Only the latest source string seen for
+     * a namespace and key is kept, so a handle refers to whichever source was asked for last. Texts already copied out
+     * of the cache keep the source they were created with.
+     * @return The handle of the text
+     */
+    int32 FindOrAddLocalized(FStringView Namespace, FStringView Key, FStringView Source, FText &OutText);
+
+    /**
+     * Finds or parses the text serialized in the given loc-text buffer.
+     * @return The handle of the text, or INDEX_NONE if it has no key and was therefore not cached
+     */
+    int32 FindOrAddLocText(FStringView LocText, FText &OutText);
+
+    /**
+     * Finds or creates the text referring to an entry of a string table.
+     * @return The handle of the text
+     */
+    int32 FindOrAddStringTableEntry(FName TableId, FStringView Key, FText &OutText);
+
+    /**
+     * Caches a text for every entry of a registered string table in one go.
+     * @return The number of entries in the table, or 0 if no table with that id is registered
+     */
+    int32 PreloadStringTable(FName TableId);
+
+    bool TryGetText(int32 Handle, FText &OutText) const;
+
+    /**
+     * Points at a counter that is bumped whenever the active culture or the loaded localization data changes, or a
+     * cached text is replaced by a newer source string.
+     */
+    const uint32 *GetCultureGeneration() const;
+
+  private:
+    /**
+     * Loc-text buffers differ in meaning by case, so they must not be matched case-insensitively like FString keys.
+     * Lookups go through a view, so finding a buffer that is already cached does not copy it.
+     */
+    struct FLocTextKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static bool Matches(const FString &A, const FStringView B)
+        {
+            return FStringView(A).Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(const FStringView Key)
+        {
+            return FCrc::MemCrc32(Key.GetData(), Key.Len() * sizeof(TCHAR));
+        }
+    };
+
+    FPokeSharpTextCache();
+
+    int32 AddText(FText &&Text);
+
+    mutable FRWLock Lock;
+    TArray<FText> Texts;
+    TMap<TPair<FTextKey, FTextKey>, int32> LocalizedHandles;
+    TMap<FString, int32, FDefaultSetAllocator, FLocTextKeyFuncs> LocTextHandles;
+    TMap<TPair<FName, FTextKey>, int32> StringTableHandles;
+    std::atomic<uint32> CultureGeneration = 0;
+};
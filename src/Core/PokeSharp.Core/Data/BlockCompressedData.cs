@@ -0,0 +1,168 @@
+﻿using System.Buffers.Binary;
+using System.IO.Compression;
+using Zomp.SyncMethodGenerator;
+
+namespace PokeSharp.Core.Data;
+
+/// <summary>
+/// The compression format used for every block of a block-compressed data file.
+/// </summary>
+/// <remarks>
+/// Only <see cref="Zlib"/> can be produced and read from managed code. The other formats are understood by the
+/// engine's native decompressor, for files written by native tooling.
+/// </remarks>
+public enum BlockCompressionFormat : byte
+{
+    Zlib = 1,
+    Gzip = 2,
+    LZ4 = 3,
+    Oodle = 4,
+}
+
+/// <summary>
+/// Reads and writes block-compressed data files. The data is split into fixed-size blocks that are compressed
+/// independently, with an index of block offsets up front, so that a reader can seek without decompressing everything
+/// that comes before the position it wants.
+/// </summary>
+/// <remarks>
+/// The header is 32 bytes: magic, version, block size, block count (all <see cref="uint"/>), the uncompressed size
+/// (<see cref="long"/>) and the <see cref="BlockCompressionFormat"/>. It is followed by block count + 1
+/// <see cref="long"/> offsets from the start of the file, the last one marking the end of the data. A block whose
+/// stored size equals its uncompressed size is stored as-is.
+/// </remarks>
+public static partial class BlockCompressedData
+{
+    public const uint Magic = 0x43424B50; // "PKBC"
+    public const uint Version = 1;
+    public const int HeaderSize = 32;
+
+    /// <summary>
+    /// Checks if the given bytes are the start of a block-compressed file.
+    /// </summary>
+    /// <param name="header">The first bytes of the file.</param>
+    /// <returns>Whether the file is block-compressed.</returns>
+    public static bool IsBlockCompressed(ReadOnlySpan<byte> header)
+    {
+        return header.Length >= HeaderSize && BinaryPrimitives.ReadUInt32LittleEndian(header) == Magic;
+    }
+
+    /// <summary>
+    /// Compresses the given data and writes it to a stream. The blocks are compressed in parallel.
+    /// </summary>
+    /// <param name="destination">The stream to write to.</param>
+    /// <param name="data">The uncompressed data.</param>
+    /// <param name="blockSize">The number of uncompressed bytes in each block.</param>
+    /// <param name="cancellationToken">A token to monitor for cancellation requests.</param>
+    [CreateSyncVersion]
+    public static async ValueTask WriteAsync(
+        Stream destination,
+        ReadOnlyMemory<byte> data,
+        int blockSize,
+        CancellationToken cancellationToken = default
+    )
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(blockSize);
+
+        var blockCount = (data.Length + blockSize - 1) / blockSize;
+        var blocks = new ReadOnlyMemory<byte>[blockCount];
+        Parallel.For(
+            0,
+            blockCount,
+            new ParallelOptions { CancellationToken = cancellationToken },
+            i =>
+            {
+                var block = data.Slice(i * blockSize, Math.Min(blockSize, data.Length - i * blockSize));
+                var compressed = Compress(block.Span);
+                blocks[i] = compressed.Length < block.Length ? compressed : block;
+            }
+        );
+
+        var header = new byte[HeaderSize + (blockCount + 1) * sizeof(long)];
+        BinaryPrimitives.WriteUInt32LittleEndian(header.AsSpan(0), Magic);
+        BinaryPrimitives.WriteUInt32LittleEndian(header.AsSpan(4), Version);
+        BinaryPrimitives.WriteInt32LittleEndian(header.AsSpan(8), blockSize);
+        BinaryPrimitives.WriteInt32LittleEndian(header.AsSpan(12), blockCount);
+        BinaryPrimitives.WriteInt64LittleEndian(header.AsSpan(16), data.Length);
+        header[24] = (byte)BlockCompressionFormat.Zlib;
+
+        long offset = header.Length;
+        for (var i = 0; i <= blockCount; i++)
+        {
+            BinaryPrimitives.WriteInt64LittleEndian(header.AsSpan(HeaderSize + i * sizeof(long)), offset);
+            if (i < blockCount)
+            {
+                offset += blocks[i].Length;
+            }
+        }
+
+        await destination.WriteAsync(header, cancellationToken);
+        foreach (var block in blocks)
+        {
+            await destination.WriteAsync(block, cancellationToken);
+        }
+    }
+
+    /// <summary>
+    /// Decompresses an entire block-compressed file.
+    /// </summary>
+    /// <param name="data">The contents of the file.</param>
+    /// <returns>The uncompressed data.</returns>
+    /// <exception cref="InvalidDataException">Thrown if the file is not a valid block-compressed file.</exception>
+    /// <exception cref="NotSupportedException">Thrown if the blocks use a format other than zlib.</exception>
+    public static byte[] Decompress(byte[] data)
+    {
+        var span = data.AsSpan();
+        if (!IsBlockCompressed(span) || BinaryPrimitives.ReadUInt32LittleEndian(span[4..]) != Version)
+            throw new InvalidDataException("Not a block-compressed data file");
+
+        var blockSize = BinaryPrimitives.ReadInt32LittleEndian(span[8..]);
+        var blockCount = BinaryPrimitives.ReadInt32LittleEndian(span[12..]);
+        var uncompressedSize = BinaryPrimitives.ReadInt64LittleEndian(span[16..]);
+        var format = (BlockCompressionFormat)span[24];
+        if (format != BlockCompressionFormat.Zlib)
+            throw new NotSupportedException($"Block compression format {format} is not supported");
+
+        if (
+            blockSize <= 0
+            || uncompressedSize is < 0 or > Array.MaxLength
+            || blockCount != (uncompressedSize + blockSize - 1) / blockSize
+            || span.Length < HeaderSize + (blockCount + 1L) * sizeof(long)
+        )
+            throw new InvalidDataException("Block-compressed data file has an invalid header");
+
+        var output = new byte[uncompressedSize];
+        for (var i = 0; i < blockCount; i++)
+        {
+            var start = BinaryPrimitives.ReadInt64LittleEndian(span[(HeaderSize + i * sizeof(long))..]);
+            var end = BinaryPrimitives.ReadInt64LittleEndian(span[(HeaderSize + (i + 1) * sizeof(long))..]);
+            var target = output.AsSpan(i * blockSize, (int)Math.Min(blockSize, uncompressedSize - (long)i * blockSize));
+            if (start < 0 || end > data.Length || end - start <= 0 || end - start > target.Length)
+                throw new InvalidDataException($"Block {i} of the block-compressed data file is out of range");
+
+            if (end - start == target.Length)
+            {
+                span[(int)start..(int)end].CopyTo(target);
+                continue;
+            }
+
+            using var zlib = new ZLibStream(
+                new MemoryStream(data, (int)start, (int)(end - start), false),
+                CompressionMode.Decompress
+            );
+            zlib.ReadExactly(target);
+        }
+
+        return output;
+    }
+
+    private static byte[] Compress(ReadOnlySpan<byte> block)
+    {
+        using var output = new MemoryStream();
+        using (var zlib = new ZLibStream(output, CompressionLevel.Optimal, true))
+        {
+            zlib.Write(block);
+        }
+
+        return output.ToArray();
+    }
+}
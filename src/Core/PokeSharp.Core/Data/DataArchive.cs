@@ -0,0 +1,127 @@
+﻿using System.IO.Compression;
+using System.IO.Hashing;
+using System.Text;
+using Zomp.SyncMethodGenerator;
+
+namespace PokeSharp.Core.Data;
+
+/// <summary>
+/// How the bytes of a data archive entry are stored.
+/// </summary>
+public enum DataArchiveCompression : byte
+{
+    None,
+    Zlib,
+}
+
+/// <summary>
+/// Constants describing the packed data archive format, which bundles every data file into a single file with a table
+/// of contents so that the engine can load them all through one handle.
+/// </summary>
+/// <remarks>
+/// The archive starts with a fixed-size header (magic, version, entry count, table of contents size) followed by the
+/// table of contents. Each entry stores its name, compression, offset, stored size, uncompressed size and a CRC-32 of
+/// the stored bytes. Entry data starts on <see cref="Alignment"/>-byte boundaries.
+/// </remarks>
+public static class DataArchive
+{
+    public const uint Magic = 0x52414B50; // "PKAR"
+    public const uint Version = 1;
+    public const int HeaderSize = 64;
+    public const int Alignment = 64;
+    public const string FileName = "Data.pkarchive";
+}
+
+/// <summary>
+/// Builds a packed data archive from a set of named entries.
+/// </summary>
+public sealed partial class DataArchiveWriter
+{
+    // Compression (1) + Offset (8) + Size (8) + UncompressedSize (8) + Crc (4) + NameLength (2)
+    private const int TocEntryFixedSize = 31;
+
+    private readonly List<Entry> _entries = [];
+
+    private sealed record Entry(byte[] Name, ReadOnlyMemory<byte> Data, DataArchiveCompression Compression, long Size);
+
+    /// <summary>
+    /// Adds an entry to the archive.
+    /// </summary>
+    /// <param name="name">The name the entry is looked up by.</param>
+    /// <param name="data">The uncompressed contents of the entry.</param>
+    /// <param name="compression">How the entry should be stored.</param>
+    public void Add(string name, ReadOnlyMemory<byte> data, DataArchiveCompression compression = DataArchiveCompression.None)
+    {
+        var nameBytes = Encoding.UTF8.GetBytes(name);
+        if (nameBytes.Length > ushort.MaxValue)
+            throw new ArgumentException($"Entry name {name} is too long", nameof(name));
+
+        var stored = compression switch
+        {
+            DataArchiveCompression.None => data,
+            DataArchiveCompression.Zlib => Compress(data.Span),
+            _ => throw new ArgumentOutOfRangeException(nameof(compression), compression, null),
+        };
+        _entries.Add(new Entry(nameBytes, stored, compression, data.Length));
+    }
+
+    /// <summary>
+    /// Writes the archive to the given stream.
+    /// </summary>
+    /// <param name="stream">The stream to write to.</param>
+    /// <param name="cancellationToken">A token to monitor for cancellation requests.</param>
+    [CreateSyncVersion]
+    public async ValueTask WriteAsync(Stream stream, CancellationToken cancellationToken = default)
+    {
+        var tocSize = _entries.Sum(e => TocEntryFixedSize + e.Name.Length);
+        var headerSize = (int)Align(DataArchive.HeaderSize + tocSize);
+        var offset = (long)headerSize;
+
+        using var header = new MemoryStream(headerSize);
+        using (var writer = new BinaryWriter(header, Encoding.UTF8, true))
+        {
+            writer.Write(DataArchive.Magic);
+            writer.Write(DataArchive.Version);
+            writer.Write(_entries.Count);
+            writer.Write(tocSize);
+            writer.Seek(DataArchive.HeaderSize, SeekOrigin.Begin);
+
+            foreach (var entry in _entries)
+            {
+                writer.Write((ushort)entry.Name.Length);
+                writer.Write(entry.Name);
+                writer.Write((byte)entry.Compression);
+                writer.Write(offset);
+                writer.Write((long)entry.Data.Length);
+                writer.Write(entry.Size);
+                writer.Write(Crc32.HashToUInt32(entry.Data.Span));
+                offset = Align(offset + entry.Data.Length);
+            }
+        }
+
+        header.SetLength(headerSize);
+        header.Position = 0;
+        await header.CopyToAsync(stream, cancellationToken);
+
+        var padding = new byte[DataArchive.Alignment];
+        foreach (var entry in _entries)
+        {
+            await stream.WriteAsync(entry.Data, cancellationToken);
+            var paddingSize = (int)(Align(entry.Data.Length) - entry.Data.Length);
+            await stream.WriteAsync(padding.AsMemory(0, paddingSize), cancellationToken);
+        }
+    }
+
+    private static long Align(long value) => (value + DataArchive.Alignment - 1) & ~(DataArchive.Alignment - 1);
+
+    private static byte[] Compress(ReadOnlySpan<byte> data)
+    {
+        using var output = new MemoryStream();
+        using (var zlib = new ZLibStream(output, CompressionLevel.Optimal, true))
+        {
+            zlib.Write(data);
+        }
+
+        return output.ToArray();
+    }
+}
@@ -1,4 +1,6 @@
-﻿namespace PokeSharp.Core.Data;
+﻿using System.Buffers;
+
+namespace PokeSharp.Core.Data;
 
 public interface IDataFileSource
 {
@@ -6,3 +8,20 @@ public interface IDataFileSource
 
     Stream OpenWrite(string path);
 }
+
+/// <summary>
+/// A data file source that is able to expose the contents of a file directly in memory, allowing callers to
+/// deserialize the data without copying it through a <see cref="Stream"/>.
+/// </summary>
+public interface IMappedDataFileSource : IDataFileSource
+{
+    /// <summary>
+    /// Attempts to map the file at the given path into memory.
+    /// </summary>
+    /// <param name="path">The path of the file to map.</param>
+    /// <returns>
+    /// The owner of the mapped memory, or <see langword="null"/> if the file could not be mapped, in which case
+    /// callers should fall back to <see cref="IDataFileSource.OpenRead"/>.
+    /// </returns>
+    IMemoryOwner<byte>? OpenMapped(string path);
+}
@@ -8,6 +8,7 @@ namespace PokeSharp.Core.Data;
 [RegisterSingleton]
 public partial class DataService(
     [ReadOnly] IOptionsMonitor<DataSettings> dataSettings,
+    [ReadOnly] IDataFileSource dataFileSource,
     IEnumerable<ILoadedGameDataSet> gameData,
     IEnumerable<IDataRepository> additionalData
 )
@@ -21,6 +22,45 @@ public partial class DataService(
         return _gameData.Select(r => (Path.Combine(basePath, $"{r.DataPath}.pkdata"), !r.IsOptional));
     }
 
+    public string GetDataArchiveFilename()
+    {
+        return Path.Combine(dataSettings.CurrentValue.DataFileBasePath, DataArchive.FileName);
+    }
+
+    /// <summary>
+    /// Packs all the data files that have been written out into a single data archive, so that the engine is able to
+    /// load them through a single handle.
+    /// </summary>
+    /// <param name="compression">How each of the entries should be stored.</param>
+    /// <param name="cancellationToken">A token to monitor for cancellation requests.</param>
+    [CreateSyncVersion]
+    public async ValueTask PackGameDataAsync(
+        DataArchiveCompression compression = DataArchiveCompression.None,
+        CancellationToken cancellationToken = default
+    )
+    {
+        var archive = new DataArchiveWriter();
+        foreach (var (fileName, isMandatory) in GetAllDataFilenames())
+        {
+            using var buffer = new MemoryStream();
+            try
+            {
+                await using var stream = dataFileSource.OpenRead(fileName);
+                await stream.CopyToAsync(buffer, cancellationToken);
+            }
+            catch (FileNotFoundException) when (!isMandatory)
+            {
+                continue;
+            }
+
+            archive.Add(Path.GetFileName(fileName), buffer.GetBuffer().AsMemory(0, (int)buffer.Length), compression);
+        }
+
+        await using var output = dataFileSource.OpenWrite(GetDataArchiveFilename());
+        output.SetLength(0);
+        await archive.WriteAsync(output, cancellationToken);
+    }
+
     [CreateSyncVersion]
     public async ValueTask LoadGameDataAsync(CancellationToken cancellationToken = default)
     {
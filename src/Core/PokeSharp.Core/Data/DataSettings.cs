@@ -3,4 +3,10 @@
 public record DataSettings
 {
     public string DataFileBasePath { get; init; } = "Data";
+
+    /// <summary>
+    /// The size of the blocks that data files are split into when they are written with block compression, or 0 to
+    /// write them uncompressed.
+    /// </summary>
+    public int CompressionBlockSize { get; init; }
 }
@@ -6,7 +6,21 @@ public class FileSystemDataFileSource(IFileSystem fileSystem) : IDataFileSource
 {
     public Stream OpenRead(string path)
     {
-        return fileSystem.File.OpenRead(path);
+        var stream = fileSystem.File.OpenRead(path);
+        Span<byte> header = stackalloc byte[BlockCompressedData.HeaderSize];
+        var headerLength = stream.ReadAtLeast(header, header.Length, false);
+        stream.Position = 0;
+        if (!BlockCompressedData.IsBlockCompressed(header[..headerLength]))
+        {
+            return stream;
+        }
+
+        using (stream)
+        {
+            var data = new byte[stream.Length];
+            stream.ReadExactly(data);
+            return new MemoryStream(BlockCompressedData.Decompress(data), false);
+        }
     }
 
     public Stream OpenWrite(string path)
@@ -1,6 +1,8 @@
-﻿using System.IO.Abstractions;
+﻿using System.Buffers;
+using System.IO.Abstractions;
 using System.Runtime.CompilerServices;
 using MessagePack;
+using Microsoft.Extensions.Options;
 using Zomp.SyncMethodGenerator;
 
 namespace PokeSharp.Core.Data;
@@ -12,7 +14,8 @@ namespace PokeSharp.Core.Data;
 public partial class MessagePackDataLoader(
     IFileSystem fileSystem,
     IDataFileSource dataFileSource,
-    MessagePackSerializerOptions options
+    MessagePackSerializerOptions options,
+    IOptionsMonitor<DataSettings> dataSettings
 ) : IDataLoader
 {
     /// <inheritdoc />
@@ -29,7 +32,16 @@ public partial class MessagePackDataLoader(
         }
 
         await using var fileStream = dataFileSource.OpenWrite(fileSystem.Path.Join("Data", $"{outputPath}.pkdata"));
-        await MessagePackSerializer.SerializeAsync(fileStream, entities, options, cancellationToken);
+        var blockSize = dataSettings.CurrentValue.CompressionBlockSize;
+        if (blockSize <= 0)
+        {
+            await MessagePackSerializer.SerializeAsync(fileStream, entities, options, cancellationToken);
+            return;
+        }
+
+        var buffer = new ArrayBufferWriter<byte>();
+        MessagePackSerializer.Serialize(buffer, entities, options, cancellationToken);
+        await BlockCompressedData.WriteAsync(fileStream, buffer.WrittenMemory, blockSize, cancellationToken);
     }
 
     /// <inheritdoc />
@@ -39,7 +51,18 @@ public partial class MessagePackDataLoader(
         [EnumeratorCancellation] CancellationToken cancellationToken = default
     )
     {
-        await using var fileStream = dataFileSource.OpenRead(fileSystem.Path.Join("Data", $"{inputPath}.pkdata"));
+        var filePath = fileSystem.Path.Join("Data", $"{inputPath}.pkdata");
+        if (TryLoadMapped<T>(filePath, cancellationToken) is { } mappedEntities)
+        {
+            foreach (var entity in mappedEntities)
+            {
+                yield return entity;
+            }
+
+            yield break;
+        }
+
+        await using var fileStream = dataFileSource.OpenRead(filePath);
         foreach (
             var entity in await MessagePackSerializer.DeserializeAsync<IEnumerable<T>>(
                 fileStream,
@@ -51,4 +74,16 @@ public partial class MessagePackDataLoader(
             yield return entity;
         }
     }
+
+    private IEnumerable<T>? TryLoadMapped<T>(string filePath, CancellationToken cancellationToken)
+    {
+        if (dataFileSource is not IMappedDataFileSource mappedDataFileSource)
+            return null;
+
+        // The entities are fully materialized by the time this returns, so the mapping can be released right away
+        using var mappedFile = mappedDataFileSource.OpenMapped(filePath);
+        return mappedFile is not null
+            ? MessagePackSerializer.Deserialize<IEnumerable<T>>(mappedFile.Memory, options, cancellationToken)
+            : null;
+    }
 }
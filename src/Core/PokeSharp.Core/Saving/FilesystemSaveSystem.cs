@@ -8,6 +8,8 @@ namespace PokeSharp.Core.Saving;
 [CreateSyncVersion]
 public partial class FilesystemSaveSystem(IFileSystem fileSystem, IOptionsMonitor<SaveDataConfig> config) : ISaveSystem
 {
+    public bool VerifiesIntegrity => false;
+
     public bool Exists(string filePath)
     {
         return fileSystem.File.Exists(Path.Join(config.CurrentValue.SaveFilePath, filePath));
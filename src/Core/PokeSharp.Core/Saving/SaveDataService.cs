@@ -1,4 +1,6 @@
-﻿using System.Collections.Immutable;
+﻿using System.Buffers;
+using System.Collections.Frozen;
+using System.Collections.Immutable;
 using MessagePack;
 using Microsoft.Extensions.Logging;
 using Microsoft.Extensions.Options;
@@ -20,13 +22,20 @@ public sealed partial class SaveDataService(
     VersioningService versioningService,
     IEnumerable<ISaveDataValue> saveDataValues,
     IEnumerable<ISaveDataConversion> conversions,
-    MessagePackSerializerOptions messagePackSerializerOptions
+    MessagePackSerializerOptions messagePackSerializerOptions,
+    ISaveSlotSummaryProvider? summaryProvider = null
 )
 {
     public static readonly Name PokeSharpVersion = "PokeSharpVersion";
     public static readonly Name GameVersion = "GameVersion";
 
     private readonly ImmutableArray<ISaveDataValue> _values = [.. saveDataValues];
+    private readonly FrozenSet<Name> _bootupValueIds = saveDataValues
+        .Where(value => value.LoadInBootup)
+        .Select(value => value.Id)
+        .Append(PokeSharpVersion)
+        .Append(GameVersion)
+        .ToFrozenSet();
     private readonly ConversionDict _conversions = conversions
         .GroupBy(x => x.TriggerType)
         .ToDictionary(x => x.Key, x => x.GroupBy(y => y.Version).ToDictionary(y => y.Key, y => y.ToImmutableArray()));
@@ -42,11 +51,7 @@ public sealed partial class SaveDataService(
     )
     {
         await using var saveDataStream = saveSystem.OpenRead(filePath);
-        return await MessagePackSerializer.DeserializeAsync<Dictionary<Name, object>>(
-            saveDataStream.Stream,
-            messagePackSerializerOptions,
-            cancellationToken
-        );
+        return await ReadAllAsync(saveDataStream, cancellationToken);
     }
 
     [CreateSyncVersion]
@@ -56,35 +61,210 @@ public sealed partial class SaveDataService(
     )
     {
         var saveData = await GetDataFromFileAsync(filepath, cancellationToken);
+        return await ConvertDataAsync(filepath, saveData, cancellationToken);
+    }
 
-        if (saveData.Count <= 0 || !await RunConversionsAsync(saveData, cancellationToken))
-            return saveData;
+    /// <summary>
+    /// Reads only the values that are loaded during bootup, along with the versions the save was written with. Save
+    /// systems that cannot read individual values, and saves that still need converting, fall back to reading and
+    /// converting the whole file.
+    /// </summary>
+    /// <param name="filepath">The path to the save file</param>
+    /// <param name="cancellationToken">The cancellation token</param>
+    /// <returns>The save data, which may hold more than just the bootup values</returns>
+    [CreateSyncVersion]
+    public async ValueTask<Dictionary<Name, object>> ReadBootupDataFromFileAsync(
+        string filepath,
+        CancellationToken cancellationToken = default
+    )
+    {
+        Dictionary<Name, object> saveData;
+        await using (var saveDataStream = await saveSystem.OpenReadAsync(filepath, cancellationToken))
+        {
+            if (saveDataStream is ISectionedSaveReadHandle sectionedHandle)
+            {
+                saveData = ReadSections(sectionedHandle, _bootupValueIds, cancellationToken);
+                if (saveData.Count == 0 || !GetConversions(saveData).Any())
+                    return saveData;
 
-        await using var saveDataStream = await saveSystem.OpenWriteAsync(filepath, cancellationToken);
-        await MessagePackSerializer.SerializeAsync(
+                // Converting needs every value, so the rest of the sections are read from the handle that is open
+                ReadSections(sectionedHandle, null, cancellationToken, saveData);
+            }
+            else
+            {
+                saveData = await ReadAllAsync(saveDataStream, cancellationToken);
+            }
+        }
+
+        return await ConvertDataAsync(filepath, saveData, cancellationToken);
+    }
+
+    [CreateSyncVersion]
+    private async ValueTask<Dictionary<Name, object>> ReadAllAsync(
+        ISaveReadHandle saveDataStream,
+        CancellationToken cancellationToken
+    )
+    {
+        if (saveDataStream is ISectionedSaveReadHandle sectionedHandle)
+        {
+            return ReadSections(sectionedHandle, null, cancellationToken);
+        }
+
+        return await MessagePackSerializer.DeserializeAsync<Dictionary<Name, object>>(
             saveDataStream.Stream,
-            saveData,
             messagePackSerializerOptions,
             cancellationToken
         );
-        await saveDataStream.CommitAsync(cancellationToken);
+    }
+
+    /// <summary>
+    /// Runs any conversions the save data needs, writing the converted data back to the file if there were some.
+    /// </summary>
+    [CreateSyncVersion]
+    private async ValueTask<Dictionary<Name, object>> ConvertDataAsync(
+        string filepath,
+        Dictionary<Name, object> saveData,
+        CancellationToken cancellationToken
+    )
+    {
+        if (saveData.Count <= 0 || !await RunConversionsAsync(saveData, cancellationToken))
+            return saveData;
+
+        await using var saveDataStream = await saveSystem.OpenWriteAsync(filepath, cancellationToken);
+        await WriteSaveDataAsync(saveDataStream, saveData, null, cancellationToken);
         return saveData;
     }
 
     [CreateSyncVersion]
-    public async ValueTask SaveToFileAsync(string filepath, CancellationToken cancellationToken = default)
+    public async ValueTask SaveToFileAsync(
+        string filepath,
+        IProgress<float>? progress = null,
+        CancellationToken cancellationToken = default
+    )
     {
         var saveData = CompileSaveDictionary();
         await using var saveDataStream = await saveSystem.OpenWriteAsync(filepath, cancellationToken);
-        await MessagePackSerializer.SerializeAsync(
-            saveDataStream.Stream,
-            saveData,
-            messagePackSerializerOptions,
-            cancellationToken
-        );
+        WriteSummary(saveDataStream);
+        await WriteSaveDataAsync(saveDataStream, saveData, progress, cancellationToken);
+    }
+
+    /// <summary>
+    /// Saves only the given values, leaving every other value in the file as it was. Save systems that cannot replace
+    /// individual values fall back to saving everything.
+    /// </summary>
+    /// <param name="filepath">The path to the save file</param>
+    /// <param name="valueIds">The IDs of the values to save</param>
+    /// <param name="progress">Receives the progress of the save, if the save system reports it</param>
+    /// <param name="cancellationToken">The cancellation token</param>
+    [CreateSyncVersion]
+    public async ValueTask SaveValuesToFileAsync(
+        string filepath,
+        IReadOnlyCollection<Name> valueIds,
+        IProgress<float>? progress = null,
+        CancellationToken cancellationToken = default
+    )
+    {
+        await using (var saveDataStream = await saveSystem.OpenWriteAsync(filepath, cancellationToken))
+        {
+            WriteSummary(saveDataStream);
+            if (saveDataStream is not ISectionedSaveWriteHandle sectionedHandle)
+            {
+                await WriteSaveDataAsync(saveDataStream, CompileSaveDictionary(), progress, cancellationToken);
+                return;
+            }
+
+            sectionedHandle.KeepUnwrittenSections = true;
+            var saveData = _values
+                .Where(value => valueIds.Contains(value.Id))
+                .ToDictionary(value => value.Id, value => value.Save());
+            await WriteSaveDataAsync(sectionedHandle, saveData, progress, cancellationToken);
+            if (!sectionedHandle.UnwrittenSectionsMissing)
+                return;
+        }
+
+        // The file had no sections to keep, so the values that were left out have to be written as well
+        await SaveToFileAsync(filepath, progress, cancellationToken);
+    }
+
+    private void WriteSummary(ISaveWriteHandle saveDataStream)
+    {
+        if (summaryProvider is not null && saveDataStream is ISectionedSaveWriteHandle sectionedHandle)
+        {
+            sectionedHandle.WriteSummary(summaryProvider.CreateSummary());
+        }
+    }
+
+    [CreateSyncVersion]
+    private async ValueTask WriteSaveDataAsync(
+        ISaveWriteHandle saveDataStream,
+        Dictionary<Name, object> saveData,
+        IProgress<float>? progress = null,
+        CancellationToken cancellationToken = default
+    )
+    {
+        if (saveDataStream is ISectionedSaveWriteHandle sectionedHandle)
+        {
+            // Serializing the values is the only part that has to happen here, the handle takes its own copy of each
+            // section so the buffer can be reused for the next one
+            var buffer = new ArrayBufferWriter<byte>();
+            foreach (var (id, value) in saveData)
+            {
+                buffer.ResetWrittenCount();
+                MessagePackSerializer.Serialize(buffer, value, messagePackSerializerOptions, cancellationToken);
+                sectionedHandle.WriteSection(id, buffer.WrittenSpan);
+            }
+
+            await sectionedHandle.CommitAsync(progress, cancellationToken);
+            return;
+        }
+
+        if (saveDataStream is IBufferedSaveWriteHandle bufferedHandle)
+        {
+            // Serialize straight into the destination buffer rather than through the stream's intermediate copies
+            MessagePackSerializer.Serialize(
+                bufferedHandle.BufferWriter,
+                saveData,
+                messagePackSerializerOptions,
+                cancellationToken
+            );
+        }
+        else
+        {
+            await MessagePackSerializer.SerializeAsync(
+                saveDataStream.Stream,
+                saveData,
+                messagePackSerializerOptions,
+                cancellationToken
+            );
+        }
+
         await saveDataStream.CommitAsync(cancellationToken);
     }
 
+    private Dictionary<Name, object> ReadSections(
+        ISectionedSaveReadHandle saveDataStream,
+        IReadOnlySet<Name>? sectionIds,
+        CancellationToken cancellationToken,
+        Dictionary<Name, object>? saveData = null
+    )
+    {
+        saveData ??= new Dictionary<Name, object>(sectionIds?.Count ?? saveDataStream.SectionIds.Count);
+        foreach (var id in saveDataStream.SectionIds)
+        {
+            // Sections that are not asked for, or that were already read, are never read from the save again
+            if (sectionIds is not null && !sectionIds.Contains(id) || saveData.ContainsKey(id))
+                continue;
+
+            saveData[id] = MessagePackSerializer.Deserialize<object>(
+                saveDataStream.ReadSection(id),
+                messagePackSerializerOptions,
+                cancellationToken
+            );
+        }
+
+        return saveData;
+    }
+
     [CreateSyncVersion]
     public async ValueTask DeleteFileAsync(CancellationToken cancellationToken = default)
     {
@@ -183,7 +363,13 @@ public sealed partial class SaveDataService(
         if (conversionsToRun.Length == 0)
             return false;
 
-        await saveSystem.CopyAsync(FilePath, $"{FilePath}.bak", cancellationToken);
+        // Save systems that checksum their saves already catch a conversion that fails to write, so only the others
+        // need a full copy to fall back on
+        if (!saveSystem.VerifiesIntegrity)
+        {
+            await saveSystem.CopyAsync(FilePath, $"{FilePath}.bak", cancellationToken);
+        }
+
         logger.LogInformation("Converting save file");
 
         foreach (var conversion in conversionsToRun)
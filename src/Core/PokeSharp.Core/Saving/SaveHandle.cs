@@ -1,4 +1,7 @@
-﻿namespace PokeSharp.Core.Saving;
+﻿using System.Buffers;
+using PokeSharp.Core.Strings;
+
+namespace PokeSharp.Core.Saving;
 
 public interface ISaveReadHandle : IDisposable, IAsyncDisposable
 {
@@ -13,3 +16,55 @@ public interface ISaveWriteHandle : IDisposable, IAsyncDisposable
 
     ValueTask CommitAsync(CancellationToken cancellationToken = default);
 }
+
+/// <summary>
+/// A write handle that can also be written to through an <see cref="IBufferWriter{T}"/>, letting serializers write
+/// directly into the destination buffer instead of going through <see cref="ISaveWriteHandle.Stream"/>.
+/// </summary>
+public interface IBufferedSaveWriteHandle : ISaveWriteHandle
+{
+    IBufferWriter<byte> BufferWriter { get; }
+}
+
+/// <summary>
+/// A read handle over a save that stores each save value as its own section, so values can be deserialized one at a
+/// time instead of as a single dictionary.
+/// </summary>
+public interface ISectionedSaveReadHandle : ISaveReadHandle
+{
+    IReadOnlyCollection<Name> SectionIds { get; }
+
+    ReadOnlyMemory<byte> ReadSection(Name id);
+}
+
+/// <summary>
+/// A write handle that stores each save value as its own section. Everything after the sections have been handed
+/// over, including compression and the write itself, is left to the handle, which may do it off the calling thread.
+/// </summary>
+public interface ISectionedSaveWriteHandle : ISaveWriteHandle
+{
+    /// <summary>
+    /// When set, sections already in the file that were not written through this handle are kept as they are, rather
+    /// than being removed when the handle is committed.
+    /// </summary>
+    bool KeepUnwrittenSections { get; set; }
+
+    /// <summary>
+    /// Set once committed if <see cref="KeepUnwrittenSections"/> was set but the file held no sections to keep, either
+    /// because it was written some other way or can no longer be read. Nothing is written in that case, since saving
+    /// only some of the values would lose the rest, so the caller has to write every section instead.
+    /// </summary>
+    bool UnwrittenSectionsMissing { get; }
+
+    void WriteSection(Name id, ReadOnlySpan<byte> data);
+
+    /// <summary>
+    /// Stores a summary of the save alongside it. Handles that are committed without one keep the summary already in
+    /// the file.
+    /// </summary>
+    void WriteSummary(SaveSlotSummary summary);
+
+    void Commit(IProgress<float>? progress);
+
+    ValueTask CommitAsync(IProgress<float>? progress, CancellationToken cancellationToken = default);
+}
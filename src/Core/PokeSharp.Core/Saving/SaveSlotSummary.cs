@@ -0,0 +1,38 @@
+﻿using System.Collections.Immutable;
+using PokeSharp.Core.Strings;
+
+namespace PokeSharp.Core.Saving;
+
+/// <summary>
+/// Enough information about a party member to draw its icon on the load screen.
+/// </summary>
+public readonly record struct SaveSlotPartyIcon(Name Species, int Form, bool Shiny, bool Female, bool Egg);
+
+/// <summary>
+/// A small summary of a save that save systems can store where it can be read without loading the rest of the save.
+/// </summary>
+public sealed record SaveSlotSummary
+{
+    public required string PlayerName { get; init; }
+
+    public TimeSpan PlayTime { get; init; }
+
+    /// <summary>
+    /// One bit per badge, in badge order.
+    /// </summary>
+    public ulong Badges { get; init; }
+
+    public ImmutableArray<SaveSlotPartyIcon> Party { get; init; } = [];
+
+    public DateTimeOffset Timestamp { get; init; }
+
+    public required string GameVersion { get; init; }
+}
+
+/// <summary>
+/// Creates the summary stored alongside a save when the game is saved.
+/// </summary>
+public interface ISaveSlotSummaryProvider
+{
+    SaveSlotSummary CreateSummary();
+}
@@ -6,6 +6,12 @@
 /// </summary>
 public interface ISaveSystem
 {
+    /// <summary>
+    /// Whether the save system checksums the saves it writes and detects corrupt saves when they are opened. Saves
+    /// kept by such a system are not backed up before being converted.
+    /// </summary>
+    bool VerifiesIntegrity { get; }
+
     /// <summary>
     /// Checks whether a file exists at the specified path.
     /// </summary>
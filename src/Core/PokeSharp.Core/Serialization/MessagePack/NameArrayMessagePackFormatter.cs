@@ -0,0 +1,81 @@
+﻿using System.Buffers;
+using System.Collections.Immutable;
+using System.Runtime.InteropServices;
+using MessagePack;
+using MessagePack.Formatters;
+using PokeSharp.Core.Strings;
+
+namespace PokeSharp.Core.Serialization.MessagePack;
+
+/// <summary>
+/// Provides a MessagePack formatter for arrays of <see cref="Name"/> that interns every element in a single batch.
+/// </summary>
+/// <remarks>
+/// The UTF-8 bytes of each element are gathered into one buffer and handed to <see cref="NameBatch.FromUtf8"/>, so
+/// data loading makes one call into the name provider per array instead of one per element.
+/// </remarks>
+public sealed class NameArrayMessagePackFormatter : IMessagePackFormatter<ImmutableArray<Name>>
+{
+    /// <inheritdoc />
+    public void Serialize(
+        ref MessagePackWriter writer,
+        ImmutableArray<Name> value,
+        MessagePackSerializerOptions options
+    )
+    {
+        if (value.IsDefault)
+        {
+            writer.WriteNil();
+            return;
+        }
+
+        writer.WriteArrayHeader(value.Length);
+        foreach (var name in value)
+        {
+            writer.Write(name.ToString());
+        }
+    }
+
+    /// <inheritdoc />
+    public ImmutableArray<Name> Deserialize(ref MessagePackReader reader, MessagePackSerializerOptions options)
+    {
+        if (reader.TryReadNil())
+        {
+            return default;
+        }
+
+        var count = reader.ReadArrayHeader();
+        if (count == 0)
+        {
+            return [];
+        }
+
+        options.Security.DepthStep(ref reader);
+        var offsets = ArrayPool<int>.Shared.Rent(count + 1);
+        var buffer = new ArrayBufferWriter<byte>();
+        try
+        {
+            offsets[0] = 0;
+            for (var i = 0; i < count; i++)
+            {
+                if (!reader.TryReadNil())
+                {
+                    var sequence = reader.ReadStringSequence().GetValueOrDefault();
+                    sequence.CopyTo(buffer.GetSpan((int)sequence.Length));
+                    buffer.Advance((int)sequence.Length);
+                }
+
+                offsets[i + 1] = buffer.WrittenCount;
+            }
+
+            var names = new Name[count];
+            NameBatch.FromUtf8(buffer.WrittenSpan, offsets.AsSpan(0, count + 1), names);
+            return ImmutableCollectionsMarshal.AsImmutableArray(names);
+        }
+        finally
+        {
+            ArrayPool<int>.Shared.Return(offsets);
+            reader.Depth--;
+        }
+    }
+}
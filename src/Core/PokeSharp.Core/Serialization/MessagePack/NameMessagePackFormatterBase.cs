@@ -19,6 +19,12 @@ public abstract class NameMessagePackFormatterBase<T> : IMessagePackFormatter<T>
     /// <inheritdoc />
     public T Deserialize(ref MessagePackReader reader, MessagePackSerializerOptions options)
     {
+        // Contiguous strings are interned straight from their UTF-8 bytes, skipping the intermediate string
+        if (reader.TryReadStringSpan(out var utf8String))
+        {
+            return !utf8String.IsEmpty ? T.FromUtf8(utf8String) : T.None;
+        }
+
         var readString = reader.ReadString();
         return !string.IsNullOrEmpty(readString) ? T.FromString(readString) : T.None;
     }
@@ -56,6 +56,12 @@ public struct CaselessName
     public static CaselessName FromString(ReadOnlySpan<char> name, FindName findType = FindName.Add) =>
         new(name, findType);
 
+    public static CaselessName FromUtf8(ReadOnlySpan<byte> name, FindName findType = FindName.Add)
+    {
+        var (comparisonIndex, _, number) = NameBatch.GetOrAddEntry(name, findType);
+        return new CaselessName(comparisonIndex, number);
+    }
+
     public static CaselessName None => new();
 
     public bool IsValid => INameProvider.Instance.IsValid(ComparisonIndex, DisplayStringIndex);
@@ -56,6 +56,27 @@ public interface ITextProvider
     /// <returns>The text data that can be polled.</returns>
     ITextData FromLocalized(ReadOnlySpan<char> ns, ReadOnlySpan<char> key, ReadOnlySpan<char> value);
 
+    /// <summary>
+    /// Creates <see cref="ITextData"/> instances for a batch of localized strings that share a namespace, such as every
+    /// line of a dialogue. Implementations backed by native code can resolve the whole batch in a single call.
+    /// </summary>
+    /// <param name="ns">The localization namespace shared by every string.</param>
+    /// <param name="keys">The localization key of each string.</param>
+    /// <param name="values">The value of each string.</param>
+    /// <param name="results">Receives the text data of each string.</param>
+    void FromLocalized(
+        ReadOnlySpan<char> ns,
+        ReadOnlySpan<string> keys,
+        ReadOnlySpan<string> values,
+        Span<ITextData> results
+    )
+    {
+        for (var i = 0; i < keys.Length; i++)
+        {
+            results[i] = FromLocalized(ns, keys[i], values[i]);
+        }
+    }
+
     ITextData FromLocText(string locString);
 
     ITextData FromLocText(ReadOnlySpan<char> locString);
@@ -36,6 +36,8 @@ public interface IName<T> : IEquatable<T>, IComparable<T>, IEqualityOperators<T,
 
     static abstract T FromString(ReadOnlySpan<char> name, FindName findType = FindName.Add);
 
+    static abstract T FromUtf8(ReadOnlySpan<byte> name, FindName findType = FindName.Add);
+
     static abstract T None { get; }
 
     bool IsValid { get; }
@@ -65,7 +67,8 @@ public readonly struct Name
         IEquatable<CaselessName>,
         IComparable<CaselessName>,
         IEqualityOperators<Name, string?, bool>,
-        IEqualityOperators<Name, CaselessName, bool>
+        IEqualityOperators<Name, CaselessName, bool>,
+        ISpanFormattable
 {
     /// <summary>
     /// Represents a "none" or null-like state for <see cref="Name"/> instances.
@@ -122,6 +125,19 @@ public readonly struct Name
 
     public static Name FromString(ReadOnlySpan<char> name, FindName findType = FindName.Add) => new(name, findType);
 
+    /// <summary>
+    /// Construct a new <see cref="Name"/> from UTF-8 encoded bytes, without transcoding them to a string first.
+    /// </summary>
+    /// <param name="name">The UTF-8 bytes to construct from.</param>
+    /// <param name="findType">
+    /// Used to determine if we should add a new name or simply try to retrieve an existing one.
+    /// </param>
+    public static Name FromUtf8(ReadOnlySpan<byte> name, FindName findType = FindName.Add)
+    {
+        var (comparisonIndex, displayIndex, number) = NameBatch.GetOrAddEntry(name, findType);
+        return new Name(comparisonIndex, displayIndex, number);
+    }
+
     /// <summary>
     /// Gets a predefined, immutable <see cref="Name"/> instance representing a "none" or null-like state.
     /// </summary>
@@ -311,6 +327,29 @@ public readonly struct Name
         return INameProvider.Instance.GetString(ComparisonIndex, DisplayStringIndex, Number);
     }
 
+    /// <inheritdoc />
+    public string ToString(string? format, IFormatProvider? formatProvider)
+    {
+        return ToString();
+    }
+
+    /// <inheritdoc />
+    public bool TryFormat(
+        Span<char> destination,
+        out int charsWritten,
+        ReadOnlySpan<char> format = default,
+        IFormatProvider? provider = null
+    )
+    {
+        return INameProvider.Instance.TryFormat(
+            ComparisonIndex,
+            DisplayStringIndex,
+            Number,
+            destination,
+            out charsWritten
+        );
+    }
+
     /// <inheritdoc />
     public override int GetHashCode()
     {
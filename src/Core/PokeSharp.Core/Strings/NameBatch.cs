@@ -0,0 +1,147 @@
+﻿using System.Buffers;
+using System.Runtime.InteropServices;
+
+namespace PokeSharp.Core.Strings;
+
+/// <summary>
+/// Helpers for interning many names at once, so that the active <see cref="INameProvider"/> is only called a single
+/// time for the whole batch.
+/// </summary>
+public static class NameBatch
+{
+    private const int StackAllocThreshold = 64;
+
+    /// <summary>
+    /// Creates a <see cref="Name"/> for each name packed back to back into a single buffer.
+    /// </summary>
+    /// <param name="buffer">The characters of every name in the batch.</param>
+    /// <param name="offsets">
+    /// The start of each name within <paramref name="buffer"/>, followed by the end of the last name.
+    /// </param>
+    /// <param name="results">
+    /// Receives the created names. Must hold at least one fewer element than <paramref name="offsets"/>.
+    /// </param>
+    /// <param name="findType">
+    /// Used to determine if we should add new names or simply try to retrieve existing ones.
+    /// </param>
+    public static void FromStrings(
+        ReadOnlySpan<char> buffer,
+        ReadOnlySpan<int> offsets,
+        Span<Name> results,
+        FindName findType = FindName.Add
+    )
+    {
+        var count = GetCount(offsets, results.Length);
+        if (count == 0)
+            return;
+
+        var rented = count > StackAllocThreshold ? ArrayPool<int>.Shared.Rent(count * 3) : null;
+        var scratch = rented is not null ? rented.AsSpan(0, count * 3) : stackalloc int[count * 3];
+        try
+        {
+            var comparisonIndices = AsUInt(scratch[..count]);
+            var displayIndices = AsUInt(scratch.Slice(count, count));
+            var numbers = scratch.Slice(count * 2, count);
+            INameProvider.Instance.GetOrAddEntries(
+                buffer,
+                offsets,
+                findType,
+                comparisonIndices,
+                displayIndices,
+                numbers
+            );
+            Fill(comparisonIndices, displayIndices, numbers, results);
+        }
+        finally
+        {
+            if (rented is not null)
+                ArrayPool<int>.Shared.Return(rented);
+        }
+    }
+
+    /// <summary>
+    /// Creates a <see cref="Name"/> for each UTF-8 encoded name packed back to back into a single buffer.
+    /// </summary>
+    /// <param name="utf8Buffer">The UTF-8 bytes of every name in the batch.</param>
+    /// <param name="offsets">
+    /// The start of each name within <paramref name="utf8Buffer"/>, followed by the end of the last name.
+    /// </param>
+    /// <param name="results">
+    /// Receives the created names. Must hold at least one fewer element than <paramref name="offsets"/>.
+    /// </param>
+    /// <param name="findType">
+    /// Used to determine if we should add new names or simply try to retrieve existing ones.
+    /// </param>
+    public static void FromUtf8(
+        ReadOnlySpan<byte> utf8Buffer,
+        ReadOnlySpan<int> offsets,
+        Span<Name> results,
+        FindName findType = FindName.Add
+    )
+    {
+        var count = GetCount(offsets, results.Length);
+        if (count == 0)
+            return;
+
+        var rented = count > StackAllocThreshold ? ArrayPool<int>.Shared.Rent(count * 3) : null;
+        var scratch = rented is not null ? rented.AsSpan(0, count * 3) : stackalloc int[count * 3];
+        try
+        {
+            var comparisonIndices = AsUInt(scratch[..count]);
+            var displayIndices = AsUInt(scratch.Slice(count, count));
+            var numbers = scratch.Slice(count * 2, count);
+            INameProvider.Instance.GetOrAddEntries(
+                utf8Buffer,
+                offsets,
+                findType,
+                comparisonIndices,
+                displayIndices,
+                numbers
+            );
+            Fill(comparisonIndices, displayIndices, numbers, results);
+        }
+        finally
+        {
+            if (rented is not null)
+                ArrayPool<int>.Shared.Return(rented);
+        }
+    }
+
+    /// <summary>
+    /// Gets the indices for a single UTF-8 encoded name without first transcoding it to UTF-16.
+    /// </summary>
+    internal static (uint ComparisonIndex, uint DisplayIndex, int Number) GetOrAddEntry(
+        ReadOnlySpan<byte> utf8Value,
+        FindName findType
+    )
+    {
+        ReadOnlySpan<int> offsets = [0, utf8Value.Length];
+        Span<uint> comparisonIndex = stackalloc uint[1];
+        Span<uint> displayIndex = stackalloc uint[1];
+        Span<int> number = stackalloc int[1];
+        INameProvider.Instance.GetOrAddEntries(utf8Value, offsets, findType, comparisonIndex, displayIndex, number);
+        return (comparisonIndex[0], displayIndex[0], number[0]);
+    }
+
+    private static int GetCount(ReadOnlySpan<int> offsets, int resultCount)
+    {
+        var count = Math.Max(offsets.Length - 1, 0);
+        ArgumentOutOfRangeException.ThrowIfLessThan(resultCount, count, nameof(resultCount));
+        return count;
+    }
+
+    private static Span<uint> AsUInt(Span<int> span) => MemoryMarshal.Cast<int, uint>(span);
+
+    private static void Fill(
+        ReadOnlySpan<uint> comparisonIndices,
+        ReadOnlySpan<uint> displayIndices,
+        ReadOnlySpan<int> numbers,
+        Span<Name> results
+    )
+    {
+        for (var i = 0; i < comparisonIndices.Length; i++)
+        {
+            results[i] = new Name(comparisonIndices[i], displayIndices[i], numbers[i]);
+        }
+    }
+}
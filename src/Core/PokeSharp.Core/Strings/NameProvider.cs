@@ -1,4 +1,7 @@
-﻿namespace PokeSharp.Core.Strings;
+﻿using System.Buffers;
+using System.Text;
+
+namespace PokeSharp.Core.Strings;
 
 /// <summary>
 /// Interface for getting the comparison and display string indices for a given name.
@@ -32,6 +35,74 @@ public interface INameProvider
     /// <returns>A tuple of the comparison and display index.</returns>
     (uint ComparisonIndex, uint DisplayIndex, int Number) GetOrAddEntry(ReadOnlySpan<char> value, FindName findType);
 
+    /// <summary>
+    /// Gets the comparison and display string indices for a batch of names packed back to back into a single buffer.
+    /// </summary>
+    /// <param name="buffer">The characters of every name in the batch.</param>
+    /// <param name="offsets">
+    /// The start of each name within <paramref name="buffer"/>, followed by the end of the last name.
+    /// </param>
+    /// <param name="findType">Used to determine if missing names should be added.</param>
+    /// <param name="comparisonIndices">Receives the comparison index of each name.</param>
+    /// <param name="displayIndices">Receives the display index of each name.</param>
+    /// <param name="numbers">Receives the number of each name.</param>
+    void GetOrAddEntries(
+        ReadOnlySpan<char> buffer,
+        ReadOnlySpan<int> offsets,
+        FindName findType,
+        Span<uint> comparisonIndices,
+        Span<uint> displayIndices,
+        Span<int> numbers
+    )
+    {
+        for (var i = 0; i < offsets.Length - 1; i++)
+        {
+            (comparisonIndices[i], displayIndices[i], numbers[i]) = GetOrAddEntry(
+                buffer[offsets[i]..offsets[i + 1]],
+                findType
+            );
+        }
+    }
+
+    /// <summary>
+    /// Gets the comparison and display string indices for a batch of UTF-8 encoded names packed back to back into a
+    /// single buffer.
+    /// </summary>
+    /// <param name="utf8Buffer">The UTF-8 bytes of every name in the batch.</param>
+    /// <param name="offsets">
+    /// The start of each name within <paramref name="utf8Buffer"/>, followed by the end of the last name.
+    /// </param>
+    /// <param name="findType">Used to determine if missing names should be added.</param>
+    /// <param name="comparisonIndices">Receives the comparison index of each name.</param>
+    /// <param name="displayIndices">Receives the display index of each name.</param>
+    /// <param name="numbers">Receives the number of each name.</param>
+    void GetOrAddEntries(
+        ReadOnlySpan<byte> utf8Buffer,
+        ReadOnlySpan<int> offsets,
+        FindName findType,
+        Span<uint> comparisonIndices,
+        Span<uint> displayIndices,
+        Span<int> numbers
+    )
+    {
+        var chars = ArrayPool<char>.Shared.Rent(Encoding.UTF8.GetMaxCharCount(utf8Buffer.Length));
+        try
+        {
+            for (var i = 0; i < offsets.Length - 1; i++)
+            {
+                var length = Encoding.UTF8.GetChars(utf8Buffer[offsets[i]..offsets[i + 1]], chars);
+                (comparisonIndices[i], displayIndices[i], numbers[i]) = GetOrAddEntry(
+                    chars.AsSpan(0, length),
+                    findType
+                );
+            }
+        }
+        finally
+        {
+            ArrayPool<char>.Shared.Return(chars);
+        }
+    }
+
     bool IsValid(uint comparisonIndex, uint displayIndex);
 
     /// <summary>
@@ -52,4 +123,20 @@ public interface INameProvider
     /// <param name="number"></param>
     /// <returns>The string that can be displayed.</returns>
     string GetString(uint comparisonIndex, uint displayStringId, int number);
+
+    /// <summary>
+    /// Writes the display string for the given index into a character span.
+    /// </summary>
+    /// <param name="comparisonIndex"></param>
+    /// <param name="displayStringId">The ID of the display string.</param>
+    /// <param name="number"></param>
+    /// <param name="destination">The span to write the display string to.</param>
+    /// <param name="charsWritten">The number of characters that were written.</param>
+    /// <returns>Whether the display string fit into <paramref name="destination"/>.</returns>
+    bool TryFormat(uint comparisonIndex, uint displayStringId, int number, Span<char> destination, out int charsWritten)
+    {
+        var displayString = GetString(comparisonIndex, displayStringId, number);
+        charsWritten = displayString.TryCopyTo(destination) ? displayString.Length : 0;
+        return charsWritten == displayString.Length;
+    }
 }
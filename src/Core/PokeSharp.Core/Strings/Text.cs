@@ -126,6 +126,31 @@ public readonly struct Text : IEquatable<Text>
         return new Text(ITextProvider.Instance.FromLocalized(ns, key, value));
     }
 
+    /// <summary>
+    /// Creates localized <see cref="Text"/> instances for a batch of strings that share a namespace.
+    /// </summary>
+    /// <param name="ns">The namespace shared by every string.</param>
+    /// <param name="keys">The key of each string.</param>
+    /// <param name="values">The localized value of each string.</param>
+    /// <param name="results">Receives the constructed <see cref="Text"/> instances.</param>
+    public static void Localized(
+        ReadOnlySpan<char> ns,
+        ReadOnlySpan<string> keys,
+        ReadOnlySpan<string> values,
+        Span<Text> results
+    )
+    {
+        ArgumentOutOfRangeException.ThrowIfNotEqual(values.Length, keys.Length, nameof(values));
+        ArgumentOutOfRangeException.ThrowIfLessThan(results.Length, keys.Length, nameof(results));
+
+        var data = new ITextData[keys.Length];
+        ITextProvider.Instance.FromLocalized(ns, keys, values, data);
+        for (var i = 0; i < data.Length; i++)
+        {
+            results[i] = new Text(data[i]);
+        }
+    }
+
     public static Text FromLocText(ReadOnlySpan<char> locString)
     {
         return new Text(ITextProvider.Instance.FromLocText(locString));
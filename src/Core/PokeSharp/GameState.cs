@@ -30,7 +30,7 @@ public partial class GameState(
     public async ValueTask SetUpSystemAsync(CancellationToken cancellationToken = default)
     {
         var saveData = saveDataService.Exists
-            ? await saveDataService.ReadDataFromFileAsync(saveDataService.FilePath, cancellationToken)
+            ? await saveDataService.ReadBootupDataFromFileAsync(saveDataService.FilePath, cancellationToken)
             : new Dictionary<Name, object>();
         if (saveData.Count == 0)
         {
@@ -0,0 +1,44 @@
+﻿using Injectio.Attributes;
+using PokeSharp.Core.Saving;
+using PokeSharp.Core.State;
+using PokeSharp.State;
+using PokeSharp.Trainers;
+
+namespace PokeSharp.Saving;
+
+/// <summary>
+/// Builds the save slot summary from the current player and game stats.
+/// </summary>
+[RegisterSingleton]
+public sealed class SaveSlotSummaryProvider(
+    IGameStateAccessor<PlayerTrainer> playerTrainer,
+    IGameStateAccessor<GameStats> gameStats,
+    SaveGameVersions saveGameVersions
+) : ISaveSlotSummaryProvider
+{
+    public SaveSlotSummary CreateSummary()
+    {
+        var player = playerTrainer.Current;
+        var badges = 0UL;
+        for (var i = 0; i < Math.Min(player.Badges.Count, 64); i++)
+        {
+            if (player.Badges[i])
+            {
+                badges |= 1UL << i;
+            }
+        }
+
+        return new SaveSlotSummary
+        {
+            PlayerName = player.Name.ToString(),
+            PlayTime = TimeSpan.FromSeconds(gameStats.Current.PlayTime),
+            Badges = badges,
+            Party =
+            [
+                .. player.Party.Select(p => new SaveSlotPartyIcon(p.Species, p.Form, p.Shiny, p.IsFemale, p.IsEgg)),
+            ],
+            Timestamp = DateTimeOffset.UtcNow,
+            GameVersion = saveGameVersions.GameVersion.ToString(),
+        };
+    }
+}
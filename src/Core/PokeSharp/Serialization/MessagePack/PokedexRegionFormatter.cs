@@ -0,0 +1,30 @@
+﻿using MessagePack;
+using MessagePack.Formatters;
+using PokeSharp.Trainers;
+
+namespace PokeSharp.Serialization.MessagePack;
+
+/// <summary>
+/// Formats the region of a Pokédex, writing the National Dex as nil so it matches an unset optional region.
+/// </summary>
+public class PokedexRegionFormatter : IMessagePackFormatter<int>
+{
+    /// <inheritdoc />
+    public void Serialize(ref MessagePackWriter writer, int value, MessagePackSerializerOptions options)
+    {
+        if (value == Pokedex.NationalDex)
+        {
+            writer.WriteNil();
+        }
+        else
+        {
+            writer.Write(value);
+        }
+    }
+
+    /// <inheritdoc />
+    public int Deserialize(ref MessagePackReader reader, MessagePackSerializerOptions options)
+    {
+        return reader.TryReadNil() ? Pokedex.NationalDex : reader.ReadInt32();
+    }
+}
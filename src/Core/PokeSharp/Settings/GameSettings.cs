@@ -1,16 +1,20 @@
 ﻿using System.Collections.Immutable;
 using Injectio.Attributes;
+using MessagePack;
 using Microsoft.Extensions.Configuration;
 using Microsoft.Extensions.DependencyInjection;
 using Microsoft.Extensions.Options;
 using PokeSharp.Core;
 using PokeSharp.Core.Strings;
+using PokeSharp.Serialization.MessagePack;
 using PokeSharp.Trainers;
 
 namespace PokeSharp.Settings;
 
+[MessagePackObject(true)]
 public readonly record struct RivalName(Name TrainerType, int Variable);
 
+[MessagePackObject(true)]
 public readonly record struct HiddenMoveBadgeRequirements()
 {
     public int Cut { get; init; } = 1;
@@ -32,6 +36,7 @@ public enum RoamingEncounterType : byte
     FishingAndWater,
 }
 
+[MessagePackObject(true)]
 public readonly record struct RoamingSpecies(
     Name Species,
     int Level,
@@ -41,7 +46,11 @@ public readonly record struct RoamingSpecies(
     ImmutableDictionary<int, ImmutableArray<int>>? RoamingAreas = null
 );
 
-public readonly record struct PokedexName(Text Name, int Region = Pokedex.NationalDex);
+[MessagePackObject(true)]
+public readonly record struct PokedexName(
+    Text Name,
+    [property: MessagePackFormatter(typeof(PokedexRegionFormatter))] int Region = Pokedex.NationalDex
+);
 
 public readonly record struct Language(Text DisplayName, string FileName);
 
@@ -54,6 +63,7 @@ public readonly record struct Language(Text DisplayName, string FileName);
 /// <param name="Y">Y coordinate of the graphic on the map, in squares.</param>
 /// <param name="Graphic">Name of the graphic, found in the Graphics/UI/Town Map folder.</param>
 /// <param name="AlwaysVisible">The graphic will always (true) or never (false) be shown on a wall map.</param>
+[MessagePackObject(true)]
 public readonly record struct RegionMapExtra(
     int RegionNumber,
     int GameSwitch,
@@ -71,8 +81,10 @@ public readonly record struct RegionMapExtra(
 /// <param name="AutoSort">
 /// Whether each pocket in turn auto-sorts itself by the order items are defined in the PBS file items.txt.
 /// </param>
+[MessagePackObject(true)]
 public readonly record struct BagPocket(Text Name, int? Size = null, bool AutoSort = false);
 
+[MessagePackObject(true)]
 public readonly record struct BadgeBoosts(int Attack, int Defense, int SpecialAttack, int SpecialDefense, int Speed);
 
 /// <summary>
@@ -85,8 +97,10 @@ public readonly record struct BadgeBoosts(int Attack, int Defense, int SpecialAt
 /// Note that this isn't perfect. Essentials doesn't accurately replicate every single generation's mechanics.
 /// It's considered to be good enough. Only generations 5 and later are reasonably supported.</param>
 [AutoServiceShortcut(Type = AutoServiceShortcutType.Options)]
-public record GameSettings(string Version, int MechanicsGeneration = 8)
+[MessagePackObject(true)]
+public record GameSettings([property: IgnoreMember] string Version, int MechanicsGeneration = 8)
 {
+    [SerializationConstructor]
     public GameSettings()
         : this("1.0.0") { }
 
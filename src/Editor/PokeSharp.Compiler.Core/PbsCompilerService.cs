@@ -40,6 +40,7 @@ public sealed partial class PbsCompilerService(
     public async Task RunCompileOnStartAsync(CancellationToken cancellationToken = default)
     {
         var dataFiles = dataService.GetAllDataFilenames().ToArray();
+        var archiveFile = new FileInfo(dataService.GetDataArchiveFilename());
         try
         {
             var mustCompile = false;
@@ -94,13 +95,11 @@ public sealed partial class PbsCompilerService(
 
             if (mustCompile)
             {
-                foreach (var dataFile in dataFiles.Select(x => new FileInfo(x.FileName)).Where(x => x.Exists))
-                {
-                    dataFile.Delete();
-                }
+                DeleteDataFiles(dataFiles, archiveFile);
 
                 logger.LogInformation("PBS files are newer than data files. Recompiling.");
                 await CompilePbsFilesAsync(cancellationToken);
+                await dataService.PackGameDataAsync(cancellationToken: cancellationToken);
             }
             else
             {
@@ -110,12 +109,23 @@ public sealed partial class PbsCompilerService(
         catch (Exception e)
         {
             logger.LogCritical(e, "Unknown exception when compiling.");
-            foreach (var dataFile in dataFiles.Select(x => new FileInfo(x.FileName)).Where(x => x.Exists))
-            {
-                dataFile.Delete();
-            }
+            DeleteDataFiles(dataFiles, archiveFile);
 
             throw new InvalidOperationException("Unknown exception when compiling.", e);
         }
     }
-}
+
+    private static void DeleteDataFiles(IEnumerable<(string FileName, bool IsMandatory)> dataFiles, FileInfo archiveFile)
+    {
+        foreach (var dataFile in dataFiles.Select(x => new FileInfo(x.FileName)).Where(x => x.Exists))
+        {
+            dataFile.Delete();
+        }
+
+        archiveFile.Refresh();
+        if (archiveFile.Exists)
+        {
+            archiveFile.Delete();
+        }
+    }
+}
\ No newline at end of file